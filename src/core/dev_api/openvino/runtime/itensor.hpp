@@ -77,7 +77,8 @@ public:
     bool is_continuous() const;
 
     /**
-     * @brief Copy tensor, destination tensor should have the same element type and shape
+     * @brief Copy tensor, destination tensor should have the same shape and either the same element type or the type
+     * which the data can be converted to on the fly (f32 <-> f16, f32 <-> bf16)
      *
      * @param dst destination tensor
      */
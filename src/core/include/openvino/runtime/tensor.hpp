@@ -164,12 +164,26 @@ public:
     const Shape& get_shape() const;
 
     /**
-     * @brief Copy tensor, destination tensor should have the same element type and shape
+     * @brief Copy tensor, destination tensor should have the same shape and either the same element type or the type
+     * which the data can be converted to on the fly (f32 <-> f16, f32 <-> bf16)
      *
      * @param dst destination tensor
      */
     void copy_to(ov::Tensor dst) const;
 
+    /**
+     * @brief Copy the region of interest of the tensor to the region of the destination tensor of the same shape
+     *
+     * @param dst destination tensor
+     * @param src_begin start coordinate of the region in the tensor (inclusive)
+     * @param src_end end coordinate of the region in the tensor (exclusive)
+     * @param dst_begin start coordinate of the region in the destination tensor (inclusive)
+     */
+    void copy_to(ov::Tensor dst,
+                 const Coordinate& src_begin,
+                 const Coordinate& src_end,
+                 const Coordinate& dst_begin) const;
+
     /**
      * @brief Reports whether the tensor is continuous or not
      *
@@ -5,8 +5,11 @@
 #include "openvino/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <regex>
 #include <string>
 #include <unordered_set>
@@ -15,6 +18,7 @@
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
 
@@ -89,12 +93,19 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                                                   std::deque<std::weak_ptr<Node>> nodes_to_run) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::apply_matcher_passes");
 
+    static const bool profile_enabled =
+        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers whose root node has a type are dispatched by the type of the node. Matchers without type based root
+    // node (or without Matcher at all) are tried on every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> untyped_matchers;
+    // number of inputs the node must have to be matched by the root of the pattern
+    constexpr size_t any_input_size = std::numeric_limits<size_t>::max();
+    std::vector<size_t> matcher_input_size(m_matchers.size(), any_input_size);
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
@@ -102,8 +113,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            untyped_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -116,28 +127,63 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
         // it's type
         // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // and the matcher is tried on every node.
+        // Both root kinds match the arguments only if the node has the same number of inputs as the root
+        // (WrapType without inputs doesn't check the arguments at all), so the nodes with other number of
+        // inputs are filtered out before running the matcher.
         if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
             if (auto any_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(p)) {
                 for (const auto& root_type_info : any_type->get_wrapped_types()) {
                     type_to_matcher[root_type_info].push_back(matcher_index);
                 }
+                if (any_type->get_input_size() != 0)
+                    matcher_input_size[matcher_index] = any_type->get_input_size();
             } else {
-                all_roots_has_type = false;
-                break;
+                untyped_matchers.push_back(matcher_index);
             }
         } else {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            matcher_input_size[matcher_index] = root->get_input_size();
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Memoized list of the matchers to run for a node type: matchers registered for the type and all its parents
+    // together with untyped matchers, in order of the registration
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matchers_to_run;
+    auto get_matchers_to_run = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto cached = type_to_matchers_to_run.find(type_info);
+        if (cached != type_to_matchers_to_run.end())
+            return cached->second;
+
+        std::vector<size_t> matcher_passes_to_run(untyped_matchers);
+        for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
+            }
+        }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                    matcher_passes_to_run.end());
+        return type_to_matchers_to_run.emplace(type_info, std::move(matcher_passes_to_run)).first->second;
+    };
+
+    // Time spent in each MatcherPass, reported with the other pass statistics if pass profiling is enabled
+    struct MatcherStats {
+        std::chrono::nanoseconds time{0};
+        size_t calls = 0;
+        size_t applied = 0;
+    };
+    std::vector<MatcherStats> matcher_stats(profile_enabled ? m_matchers.size() : 0);
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, const std::shared_ptr<Node>& node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -150,7 +196,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status;
+        if (profile_enabled) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            auto& stats = matcher_stats[matcher_index];
+            stats.time += std::chrono::steady_clock::now() - start;
+            stats.calls++;
+            stats.applied += status;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -166,9 +222,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -191,50 +244,26 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        const auto input_size = node->get_input_size();
+        for (size_t matcher_index : get_matchers_to_run(node->get_type_info())) {
+            if (matcher_input_size[matcher_index] != any_input_size && matcher_input_size[matcher_index] != input_size)
+                continue;
+            if (run_matcher_pass(matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
     }
+
+    for (size_t matcher_index = 0; matcher_index < matcher_stats.size(); ++matcher_index) {
+        const auto& stats = matcher_stats[matcher_index];
+        if (stats.calls == 0)
+            continue;
+        std::cout << std::setw(7) << std::chrono::duration_cast<std::chrono::milliseconds>(stats.time).count()
+                  << "ms   " << m_matchers[matcher_index]->get_name() << " (" << stats.calls << " calls, "
+                  << stats.applied << " applied)\n";
+    }
     return rewritten;
 }
 
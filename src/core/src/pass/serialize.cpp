@@ -16,6 +16,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/opsets/opset1.hpp"
@@ -64,21 +65,68 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+// MurmurHash64A, the data may be unaligned
+uint64_t hash_bytes(const char* data, size_t size, uint64_t seed) {
+    constexpr uint64_t m = 0xc6a4a7935bd1e995ULL;
+    constexpr int r = 47;
+    uint64_t h = seed ^ (static_cast<uint64_t>(size) * m);
+    const auto d_end = data + size / sizeof(uint64_t) * sizeof(uint64_t);
+    for (auto d = data; d != d_end; d += sizeof(uint64_t)) {
+        uint64_t k;
+        std::memcpy(&k, d, sizeof(k));
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    if (size % sizeof(uint64_t) != 0) {
+        uint64_t last_bytes{0};
+        std::memcpy(&last_bytes, d_end, size % sizeof(uint64_t));
+        h ^= last_bytes;
+        h *= m;
+    }
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+// The data is hashed by the chunks of the fixed size in parallel, so the hash doesn't depend on the number of threads
+uint64_t hash_data(const char* data, size_t size) {
+    constexpr size_t chunk_size = 1 << 20;
+    const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    if (num_chunks <= 1) {
+        return hash_bytes(data, size, 0);
+    }
+    std::vector<uint64_t> chunk_hashes(num_chunks);
+    ov::parallel_for(num_chunks, [&](size_t i) {
+        const size_t offset = i * chunk_size;
+        chunk_hashes[i] = hash_bytes(data + offset, std::min(chunk_size, size - offset), i);
+    });
+    return hash_bytes(reinterpret_cast<const char*>(chunk_hashes.data()),
+                      chunk_hashes.size() * sizeof(uint64_t),
+                      static_cast<uint64_t>(size));
+}
+
+// The constants are compressed to FP16 by the chunks, each one is converted in parallel by the blocks
+constexpr size_t fp16_chunk_elements = 1 << 20;
+constexpr size_t fp16_block_elements = 1 << 16;
+
+void convert_from_f64_to_f16_with_clamp(const double* src_data, ov::float16* dst_data, size_t count) {
+    // Reference implementation for fp64 to fp16 conversoin
+    for (size_t i = 0; i < count; ++i) {
+        // if abs value is smaller than the smallest positive fp16, but not zero
+        if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
+            dst_data[i] = 0;
+        } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
+            dst_data[i] = std::numeric_limits<ov::float16>::max();
+        } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
+            dst_data[i] = std::numeric_limits<ov::float16>::lowest();
+        } else {
+            dst_data[i] = static_cast<ov::float16>(src_data[i]);
+        }
+    }
 }
 
 class ConstantWriter {
@@ -114,11 +162,8 @@ public:
         // can avoid comparing FP32 weights, but it would require comparing with data from a file, because on-the-fly
         // converted FP16 constants are not kept in memory.
 
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
+        // The hash is strong enough to make the collisions unlikely, but the data is still compared for the match
+        const HashValue hash = static_cast<HashValue>(hash_data(ptr, size));
         const auto found = m_hash_to_file_positions.find(hash);
         if (found != end(m_hash_to_file_positions) &&
             memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
@@ -139,48 +184,43 @@ private:
                                               ov::element::Type src_type = ov::element::dynamic) {
         if (!compress_to_fp16) {
             m_binary_output.write(ptr, size);
-        } else {
-            OPENVINO_ASSERT(size % src_type.size() == 0);
-            auto fp16_buffer = compress_data_to_fp16(ptr, size, src_type, new_size);
-            m_binary_output.write(fp16_buffer.get(), *new_size);
-            // Compressed data is disposed
+            return;
+        }
+        OPENVINO_ASSERT(size % src_type.size() == 0);
+        const auto num_src_elements = size / src_type.size();
+        *new_size = num_src_elements * ov::element::f16.size();
+        if (num_src_elements == 0) {
+            return;
+        }
+        // The data is converted and written by the chunks, so the memory doesn't grow with the size of the constant
+        const auto chunk_elements = std::min(num_src_elements, fp16_chunk_elements);
+        std::unique_ptr<ov::float16[]> fp16_buffer(new ov::float16[chunk_elements]);
+        for (size_t offset = 0; offset < num_src_elements; offset += chunk_elements) {
+            const auto count = std::min(chunk_elements, num_src_elements - offset);
+            compress_data_to_fp16(ptr + offset * src_type.size(), count, src_type, fp16_buffer.get());
+            m_binary_output.write(reinterpret_cast<const char*>(fp16_buffer.get()), count * ov::element::f16.size());
         }
     }
 
-    std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
-                                                  size_t size,
-                                                  ov::element::Type src_type,
-                                                  size_t* compressed_size) {
-        auto num_src_elements = size / src_type.size();
-        *compressed_size = num_src_elements * ov::element::f16.size();
-        if (src_type == ov::element::f32) {
-            auto new_ptr = std::unique_ptr<char[]>(new char[*compressed_size]);
-            auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
-            auto src_data = reinterpret_cast<const float*>(ptr);
-            ngraph::runtime::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
-            return new_ptr;
-        } else if (src_type == ov::element::f64) {
-            auto new_ptr = std::unique_ptr<char[]>(new char[*compressed_size]);
-            auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
-            auto src_data = reinterpret_cast<const double*>(ptr);
-
-            // Reference implementation for fp64 to fp16 conversoin
-            for (size_t i = 0; i < num_src_elements; ++i) {
-                // if abs value is smaller than the smallest positive fp16, but not zero
-                if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
-                    dst_data[i] = 0;
-                } else if (src_data[i] > std::numeric_limits<ov::float16>::max()) {
-                    dst_data[i] = std::numeric_limits<ov::float16>::max();
-                } else if (src_data[i] < std::numeric_limits<ov::float16>::lowest()) {
-                    dst_data[i] = std::numeric_limits<ov::float16>::lowest();
-                } else {
-                    dst_data[i] = static_cast<ov::float16>(src_data[i]);
-                }
+    static void compress_data_to_fp16(const char* ptr, size_t count, ov::element::Type src_type, ov::float16* dst) {
+        OPENVINO_ASSERT(src_type == ov::element::f32 || src_type == ov::element::f64,
+                        "[ INTERNAL ERROR ] Not supported source type for weights compression: ",
+                        src_type);
+        const size_t num_blocks = (count + fp16_block_elements - 1) / fp16_block_elements;
+        ov::parallel_for(num_blocks, [&](size_t block) {
+            const auto start = block * fp16_block_elements;
+            const auto block_count = std::min(fp16_block_elements, count - start);
+            if (src_type == ov::element::f32) {
+                ngraph::runtime::reference::convert_from_f32_to_f16_with_clamp(
+                    reinterpret_cast<const float*>(ptr) + start,
+                    dst + start,
+                    block_count);
+            } else {
+                convert_from_f64_to_f16_with_clamp(reinterpret_cast<const double*>(ptr) + start,
+                                                   dst + start,
+                                                   block_count);
             }
-            return new_ptr;
-        } else {
-            OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
-        }
+        });
     }
 
     ConstWritePositions m_hash_to_file_positions;
@@ -4,9 +4,12 @@
 
 #include "openvino/runtime/itensor.hpp"
 
+#include <cstring>
 #include <memory>
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/reference/convert.hpp"
 #include "openvino/runtime/allocator.hpp"
 #include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -44,6 +47,69 @@ bool ITensor::is_continuous() const {
     return byte_strides == get_strides();
 }
 
+namespace {
+
+bool is_supported_conversion(const element::Type& src_type, const element::Type& dst_type) {
+    return src_type == dst_type ||
+           (src_type == element::f32 && (dst_type == element::f16 || dst_type == element::bf16)) ||
+           (dst_type == element::f32 && (src_type == element::f16 || src_type == element::bf16));
+}
+
+void convert_elements(const uint8_t* src,
+                      const element::Type& src_type,
+                      uint8_t* dst,
+                      const element::Type& dst_type,
+                      size_t count) {
+    using namespace ngraph::runtime::reference;
+    if (src_type == dst_type) {
+        std::memcpy(dst, src, count * src_type.size());
+    } else if (src_type == element::f32 && dst_type == element::f16) {
+        convert(reinterpret_cast<const float*>(src), reinterpret_cast<float16*>(dst), count);
+    } else if (src_type == element::f16 && dst_type == element::f32) {
+        convert(reinterpret_cast<const float16*>(src), reinterpret_cast<float*>(dst), count);
+    } else if (src_type == element::f32 && dst_type == element::bf16) {
+        convert(reinterpret_cast<const float*>(src), reinterpret_cast<bfloat16*>(dst), count);
+    } else if (src_type == element::bf16 && dst_type == element::f32) {
+        convert(reinterpret_cast<const bfloat16*>(src), reinterpret_cast<float*>(dst), count);
+    } else {
+        OPENVINO_THROW("Tensor element types are not equal. (src: ", src_type, " != dst: ", dst_type, ")");
+    }
+}
+
+struct CopyDim {
+    size_t size;
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+// Drops the unit dimensions and merges the dimensions laid out continuously in both tensors, so the innermost
+// dimension is the longest run of the elements which can be copied at once
+std::vector<CopyDim> collapse_dims(const Shape& shape,
+                                   const Strides& src_strides,
+                                   const Strides& dst_strides,
+                                   size_t src_elem_size,
+                                   size_t dst_elem_size) {
+    std::vector<CopyDim> dims;
+    for (size_t i = shape.size(); i > 0; --i) {
+        const auto idx = i - 1;
+        if (shape[idx] == 1)
+            continue;
+        if (!dims.empty()) {
+            auto& inner = dims.front();
+            if (src_strides[idx] == inner.src_stride * inner.size && dst_strides[idx] == inner.dst_stride * inner.size) {
+                inner.size *= shape[idx];
+                continue;
+            }
+        }
+        dims.insert(dims.begin(), CopyDim{shape[idx], src_strides[idx], dst_strides[idx]});
+    }
+    if (dims.empty())
+        dims.push_back(CopyDim{1, src_elem_size, dst_elem_size});
+    return dims;
+}
+
+}  // namespace
+
 void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
     const auto& is_scalar = [](const ov::Shape& shape) {
         return shape.empty() || (shape.size() == 1 && shape[0] == 1);
@@ -57,11 +123,13 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
                     "Default copy to doesn't support copy from remote tensor.");
     OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(dst),
                     "Default copy to doesn't support copy to remote tensor.");
-    OPENVINO_ASSERT(dst->get_element_type() == get_element_type(),
+    const auto& src_type = get_element_type();
+    const auto& dst_type = dst->get_element_type();
+    OPENVINO_ASSERT(src_type == dst_type || (src_type.bitwidth() >= 8 && is_supported_conversion(src_type, dst_type)),
                     "Tensor element types are not equal. (src: ",
-                    get_element_type(),
+                    src_type,
                     " != dst: ",
-                    dst->get_element_type(),
+                    dst_type,
                     ")");
     if (dst->get_shape() == ov::Shape{0})
         dst->set_shape(get_shape());
@@ -71,106 +139,68 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
                     " != dst: ",
                     dst->get_shape(),
                     ")");
-    const auto& shape = get_shape();
+    if (get_size() == 0)
+        return;
     auto* src_data = static_cast<const uint8_t*>(data());
     auto* dst_data = static_cast<uint8_t*>(dst->data());
-    ov::Strides src_strides{get_byte_size()};
-    ov::Strides dst_strides{dst->get_byte_size()};
-    ov::Shape cur_pos{0};
-    ov::Shape max_pos{1};
 
-    if (get_element_type().bitwidth() < 8 || (get_strides() == dst->get_strides() && is_continuous()) ||
-        (is_scalar(get_shape()) && is_scalar(dst->get_shape()))) {
+    if (src_type.bitwidth() < 8) {
         // OpenVINO doesn't support strides for LP types
-        // or both tensors have default strides
-        // Strides and positions already initialized
-    } else {
-        // Tensors have default strides
-        const auto& type = get_element_type();
-        std::vector<size_t> strides(shape.size());
-        if (!shape.empty()) {
-            strides[shape.size() - 1] = 1;
-        }
-        auto size = shape.size();
-        for (size_t i = 1; i < size; i++) {
-            strides[size - i - 1] = strides[size - i] * shape[size - i];
-        }
-
-        ov::Strides default_strides(strides.size());
-        for (size_t i = 0; i < strides.size(); ++i)
-            default_strides[i] = strides[i] * type.size();
-
-        src_strides = get_strides();
-        dst_strides = dst->get_strides();
-
-        ov::Strides src_str, dst_str;
-
-        // Calculate src and dst shapes
-        bool found_step = false;
-        for (size_t i = 0; i < shape.size(); i++) {
-            size_t inverted_idx = shape.size() - i - 1;
-            if (!found_step) {
-                if (default_strides[inverted_idx] == src_strides[inverted_idx] &&
-                    src_strides[inverted_idx] == dst_strides[inverted_idx]) {
-                    continue;
-                } else {
-                    found_step = true;
-                    size_t strides_size = inverted_idx + 1;
-                    // Set right size
-                    src_str.resize(strides_size + 1);
-                    dst_str.resize(strides_size + 1);
-                    max_pos.resize(strides_size + 1);
-                    cur_pos.resize(strides_size + 1);
-                    // In case of default continuous strides we can copy several elements
-                    // In other case only one element
-                    size_t dim = 1;
-                    size_t strides = type.size();
-
-                    if (strides_size < default_strides.size()) {
-                        strides = default_strides[strides_size];
-                        dim = get_shape()[strides_size];
-                    }
-                    src_str[strides_size] = strides;
-                    dst_str[strides_size] = strides;
-                    max_pos[strides_size] = dim;
-                    cur_pos[strides_size] = 0;
-                }
-            }
-            src_str[inverted_idx] = src_strides[inverted_idx];
-            dst_str[inverted_idx] = dst_strides[inverted_idx];
-            max_pos[inverted_idx] = shape[inverted_idx];
-            cur_pos[inverted_idx] = 0;
-        }
-        src_strides = src_str;
-        dst_strides = dst_str;
+        std::memcpy(dst_data, src_data, get_byte_size());
+        return;
     }
 
-    const auto update_index = [](const ov::Shape& pos, const ov::Shape& shape, const ov::Strides& strides) {
-        size_t offset = 0;
+    std::vector<CopyDim> dims;
+    if (is_scalar(get_shape()) && is_scalar(dst->get_shape())) {
+        dims.push_back(CopyDim{1, src_type.size(), dst_type.size()});
+    } else {
+        dims = collapse_dims(get_shape(), get_strides(), dst->get_strides(), src_type.size(), dst_type.size());
+    }
 
-        for (size_t i = 0; i < pos.size(); i++) {
-            offset += pos[i] * strides[i];
+    // The innermost run of the elements is split to the chunks, which are copied in parallel together with the rows
+    // of the outer dimensions
+    constexpr size_t chunk_elements = 1 << 16;
+    constexpr size_t min_parallel_bytes = 1 << 18;
+    const auto& inner = dims.back();
+    const bool inner_dense = inner.src_stride == src_type.size() && inner.dst_stride == dst_type.size();
+    const size_t chunk = inner_dense ? std::min(inner.size, chunk_elements) : inner.size;
+    const size_t chunks_per_row = (inner.size + chunk - 1) / chunk;
+    size_t rows = 1;
+    for (size_t i = 0; i + 1 < dims.size(); ++i)
+        rows *= dims[i].size;
+
+    const auto copy_work_item = [&](size_t item) {
+        size_t row = item / chunks_per_row;
+        const size_t chunk_start = (item % chunks_per_row) * chunk;
+        const size_t count = std::min(chunk, inner.size - chunk_start);
+        size_t src_offset = chunk_start * inner.src_stride;
+        size_t dst_offset = chunk_start * inner.dst_stride;
+        for (size_t i = dims.size() - 1; i > 0; --i) {
+            const auto& dim = dims[i - 1];
+            const auto pos = row % dim.size;
+            row /= dim.size;
+            src_offset += pos * dim.src_stride;
+            dst_offset += pos * dim.dst_stride;
         }
-        return offset;
-    };
-
-    bool finish = false;
-    for (size_t dst_idx = 0, src_idx = 0; !finish;) {
-        memcpy(dst_data + dst_idx, src_data + src_idx, src_strides[src_strides.size() - 1]);
-        // update indexes
-        for (size_t i = 0; i < cur_pos.size(); i++) {
-            size_t inverted_idx = cur_pos.size() - i - 1;
-            cur_pos[inverted_idx]++;
-            if (cur_pos[inverted_idx] != max_pos[inverted_idx]) {
-                break;
+        if (inner_dense) {
+            convert_elements(src_data + src_offset, src_type, dst_data + dst_offset, dst_type, count);
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                convert_elements(src_data + src_offset + i * inner.src_stride,
+                                 src_type,
+                                 dst_data + dst_offset + i * inner.dst_stride,
+                                 dst_type,
+                                 1);
             }
-            if (inverted_idx)
-                cur_pos[inverted_idx] = 0;
-            else
-                finish = true;
         }
-        src_idx = update_index(cur_pos, max_pos, src_strides);
-        dst_idx = update_index(cur_pos, max_pos, dst_strides);
+    };
+
+    const size_t work_items = rows * chunks_per_row;
+    if (work_items > 1 && get_size() * std::max(src_type.size(), dst_type.size()) >= min_parallel_bytes) {
+        ov::parallel_for(work_items, copy_work_item);
+    } else {
+        for (size_t item = 0; item < work_items; ++item)
+            copy_work_item(item);
     }
 }
 
@@ -79,6 +79,20 @@ void Tensor::copy_to(ov::Tensor dst) const {
     OV_TENSOR_STATEMENT(_impl->copy_to(dst._impl));
 }
 
+void Tensor::copy_to(ov::Tensor dst,
+                     const Coordinate& src_begin,
+                     const Coordinate& src_end,
+                     const Coordinate& dst_begin) const {
+    OPENVINO_ASSERT(src_begin.size() == src_end.size() && src_begin.size() == dst_begin.size(),
+                    "The coordinates of the regions must have the same rank");
+    Coordinate dst_end(dst_begin.size());
+    for (size_t i = 0; i < dst_begin.size(); ++i) {
+        OPENVINO_ASSERT(src_begin[i] <= src_end[i], "The region of the tensor is empty along the axis ", i);
+        dst_end[i] = dst_begin[i] + (src_end[i] - src_begin[i]);
+    }
+    Tensor(*this, src_begin, src_end).copy_to(Tensor(dst, dst_begin, dst_end));
+}
+
 Strides Tensor::get_strides() const {
     OV_TENSOR_STATEMENT(return _impl->get_strides(););
 }
@@ -579,3 +579,43 @@ INSTANTIATE_TEST_SUITE_P(copy_tests,
                                                               }
                                            )));
 // clang-format on
+
+TEST_F(OVTensorTest, copyToConvertsF32ToF16AndBack) {
+    ov::Tensor full_src{ov::element::f32, {2, 3, 8}};
+    init_tensor(full_src, true);
+    ov::Tensor src{full_src, {0, 1, 2}, {2, 3, 6}};
+    ov::Tensor dst_f16{ov::element::f16, src.get_shape()};
+    src.copy_to(dst_f16);
+
+    ov::Tensor full_dst{ov::element::f32, {2, 3, 8}};
+    init_tensor(full_dst, false);
+    ov::Tensor dst_f32{full_dst, {0, 0, 4}, {2, 2, 8}};
+    dst_f16.copy_to(dst_f32);
+    compare_tensors(src, dst_f32);
+
+    ov::Tensor dst_i32{ov::element::i32, src.get_shape()};
+    ASSERT_THROW(src.copy_to(dst_i32), ov::Exception);
+}
+
+TEST_F(OVTensorTest, copyToRegion) {
+    ov::Tensor src{ov::element::i32, {1, 3, 4, 8}};
+    init_tensor(src, true);
+    ov::Tensor dst{ov::element::i32, {1, 3, 6, 6}};
+    init_tensor(dst, false);
+
+    src.copy_to(dst, {0, 0, 1, 2}, {1, 3, 3, 7}, {0, 0, 3, 1});
+    compare_tensors(ov::Tensor{src, {0, 0, 1, 2}, {1, 3, 3, 7}}, ov::Tensor{dst, {0, 0, 3, 1}, {1, 3, 5, 6}});
+    EXPECT_EQ(-1, dst.data<int32_t>()[0]);
+
+    ASSERT_THROW(src.copy_to(dst, {0, 0, 0, 0}, {1, 3, 4, 8}, {0, 0, 0, 0}), ov::Exception);
+    ASSERT_THROW(src.copy_to(dst, {0, 0, 1}, {1, 3, 3}, {0, 0, 3}), ov::Exception);
+}
+
+TEST_F(OVTensorTest, copyToLargeStridedTensor) {
+    ov::Tensor full_src{ov::element::f32, {4, 300, 520}};
+    init_tensor(full_src, true);
+    ov::Tensor src{full_src, {0, 0, 4}, {4, 300, 516}};
+    ov::Tensor dst{ov::element::f32, src.get_shape()};
+    src.copy_to(dst);
+    compare_tensors(src, dst);
+}
@@ -213,3 +213,27 @@ TEST_F(SerializationConstantCompressionTest, IdenticalConstantsDifferentTypesI32
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializationConstantCompressionTest, LargeConstants) {
+    constexpr int unique_const_count = 2;
+    // spans several chunks hashed in parallel
+    const ov::Shape shape{3, 1000, 1000};
+
+    std::vector<float> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(i % 1021);
+    }
+    auto A = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    values.back() += 1.0f;
+    auto C = ov::opset8::Constant::create(ov::element::f32, shape, values);
+
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(float));
+}
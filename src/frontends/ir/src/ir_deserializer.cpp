@@ -12,6 +12,7 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -430,13 +431,28 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+    std::vector<pugi::xml_node> layer_nodes;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layer_nodes.push_back(node); }
+
+    // Parse the generic parameters (ports description) of all layers in parallel as they make up the most of IR
+    std::vector<GenericLayerParams> layer_params(layer_nodes.size());
+    std::vector<std::exception_ptr> layer_errors(layer_nodes.size());
+    ov::parallel_for(layer_nodes.size(), [&](size_t i) {
+        try {
+            layer_params[i] = parse_generic_params(layer_nodes[i]);
+        } catch (...) {
+            layer_errors[i] = std::current_exception();
+        }
+    });
+
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
+    for (size_t i = 0; i < layer_nodes.size(); i++) {
+        if (layer_errors[i])
+            std::rethrow_exception(layer_errors[i]);
+        const auto& node_param = layer_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -447,7 +463,11 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+        const auto layer_id = node_param.layerId;
+        params[layer_id] = {layer_nodes[i], std::move(layer_params[i])};
     }
+    layer_nodes.clear();
+    layer_params.clear();
 
     // Read all edges and store them for further usage
     FOREACH_CHILD (_ec, root.child("edges"), "edge") {
@@ -415,6 +415,86 @@ TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+TEST_F(IRFrontendTests, input_model_converted_twice) {
+    std::string xmlModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32" names="input_tensor">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32" names="relu_tensor">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::istringstream modelStringStream(xmlModel);
+    std::istream& modelStream = modelStringStream;
+    ov::AnyVector params{&modelStream};
+
+    auto FE = manager.load_by_model(params);
+    ASSERT_TRUE(!!FE);
+    auto inputModel = FE->load(params);
+    ASSERT_TRUE(!!inputModel);
+
+    // the input model stays convertible after the conversion
+    std::shared_ptr<ov::Model> first, second;
+    ASSERT_NO_THROW(first = FE->convert(inputModel));
+    ASSERT_NO_THROW(second = FE->convert(inputModel));
+    ASSERT_TRUE(!!first);
+    ASSERT_TRUE(!!second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(second->get_ops().size(), 3u);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::RUNTIME_KEYS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::TENSOR_NAMES);
+    const auto res = fc.compare(first, second);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
 TEST_F(IRFrontendTests, model_with_wrong_shape) {
     std::string xmlModel = R"V0G0N(
 <?xml version="1.0" ?>
@@ -108,13 +108,17 @@ public:
     };
 
     Tensor() = delete;
+    /// \param model_proto The model owning the tensor. If it's set, the constant made of the tensor raw data refers
+    ///                    to the data in the model and keeps the model alive instead of holding the copy of it.
     Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
            const std::string& model_dir,
-           detail::MappedMemoryHandles mmap_cache)
+           detail::MappedMemoryHandles mmap_cache,
+           std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
           m_model_dir{model_dir},
-          m_mmap_cache{mmap_cache} {
+          m_mmap_cache{mmap_cache},
+          m_model_proto{std::move(model_proto)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -200,6 +204,16 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (has_external_data()) {
+            return make_external_data_constant(get_ng_type());
+        }
+        if (m_model_proto && m_tensor_proto->has_raw_data()) {
+            const auto& type = get_ng_type();
+            const auto& raw_data = m_tensor_proto->raw_data();
+            if (!raw_data.empty() && raw_data.size() == shape_size(m_shape) * type.size()) {
+                return make_raw_data_constant(type);
+            }
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -233,6 +247,42 @@ public:
     }
 
 private:
+    std::shared_ptr<ngraph::op::Constant> make_external_data_constant(const element::Type& type) const {
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
+        if (m_mmap_cache) {
+            constant = std::make_shared<ngraph::op::Constant>(type,
+                                                              m_shape,
+                                                              ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache));
+        } else {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
+        }
+        if (constant->get_byte_size() != ov::shape_size(m_shape) * type.size()) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
+    std::shared_ptr<ngraph::op::Constant> make_raw_data_constant(const element::Type& type) const {
+        const auto& raw_data = m_tensor_proto->raw_data();
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+            const_cast<char*>(raw_data.data()),
+            raw_data.size(),
+            m_model_proto);
+        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        OPENVINO_SUPPRESS_DEPRECATED_END
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     template <typename T,
               typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value ||
                                           std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
@@ -241,23 +291,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         size_t data_size = get_data_size();
-        if (has_external_data()) {
-            const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
-            if (m_mmap_cache) {
-                constant =
-                    std::make_shared<ngraph::op::Constant>(type,
-                                                           m_shape,
-                                                           ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache));
-            } else {
-                constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
-            }
-            if (constant->get_byte_size() != ov::shape_size(m_shape) * type.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -355,6 +389,7 @@ private:
     Shape m_shape;
     std::string m_model_dir;
     detail::MappedMemoryHandles m_mmap_cache;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
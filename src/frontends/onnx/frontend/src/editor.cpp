@@ -302,6 +302,15 @@ struct onnx_editor::ONNXModelEditor::Impl {
         graph_topological_sort(m_model_proto->mutable_graph());
     }
 
+    /// \brief Makes the own copy of the model before the initializers are modified, if the model is shared with the
+    ///        converted models. Their constants refer to the initializers data instead of holding the copy of it.
+    void detach_model_proto() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+            m_is_mapper_updated = false;
+        }
+    }
+
     Impl(const std::string& model_path)
         : Impl(std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))) {}
 
@@ -455,6 +464,7 @@ void onnx_editor::ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>
         return;
     }
 
+    m_pimpl->detach_model_proto();
     if (!outputs.empty()) {
         m_pimpl->m_model_proto->mutable_graph()->mutable_output()->Clear();
     }
@@ -542,6 +552,7 @@ std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
@@ -1394,6 +1394,31 @@ OPENVINO_TEST(onnx_editor, values__modify_one_initializer) {
     test_case.run();
 }
 
+OPENVINO_TEST(onnx_editor, values__modify_initializer_after_conversion) {
+    onnx_editor::ONNXModelEditor editor{
+        ngraph::file_util::path_join(ov::test::utils::getExecutableDirectory(),
+                                     SERIALIZED_ZOO,
+                                     "onnx/model_editor/add_1D_with_initializers.onnx")};
+    std::map<std::string, std::shared_ptr<ngraph::op::Constant>> in_vals;
+
+    in_vals.emplace("B", ngraph::op::Constant::create(element::i64, Shape{2}, {3, 4}));
+    editor.set_input_values(in_vals);
+    const auto function = editor.get_function();
+
+    // the constants of the converted model refer to the initializers, they must not be affected by the next edit
+    in_vals["B"] = ngraph::op::Constant::create(element::i64, Shape{2}, {5, 6});
+    editor.set_input_values(in_vals);
+    const auto modified_function = editor.get_function();
+
+    auto test_case = ov::test::TestCase(function);
+    test_case.add_expected_output<int64_t>(Shape{2}, {4, 6});
+    test_case.run();
+
+    auto modified_test_case = ov::test::TestCase(modified_function);
+    modified_test_case.add_expected_output<int64_t>(Shape{2}, {6, 8});
+    modified_test_case.run();
+}
+
 OPENVINO_TEST(onnx_editor, values__modify_two_initializers) {
     onnx_editor::ONNXModelEditor editor{
         ngraph::file_util::path_join(ov::test::utils::getExecutableDirectory(),
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -184,6 +185,41 @@ public:
         return compile_model(model, device_name, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Starts creation of a compiled model from a source model object and returns without waiting for it.
+     *
+     * The model is compiled in a separate thread, so the application can prepare the inputs or compile other models
+     * meanwhile. The compilation keeps the core state alive, so the core object can be destroyed before it finishes.
+     * Unlike the future of std::async, the returned future doesn't wait for the compilation when it is destroyed: the
+     * discarded compilation runs to the end in the background and its result is released. The application must not
+     * exit before the started compilations are completed.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return The future of the compiled model. The future rethrows the exception if the compilation fails.
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Starts reading and compilation of a model from the IR/ONNX/PDPD file and returns without waiting for it.
+     *
+     * The returned future behaves as the one of the overload taking the model object: it doesn't wait for the
+     * compilation when it is destroyed.
+     *
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return The future of the compiled model. The future rethrows the exception if the compilation fails.
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
     /**
      * @brief Reads and loads a compiled model from the IR/ONNX/PDPD file to the default OpenVINO device selected by the
      * AUTO plugin.
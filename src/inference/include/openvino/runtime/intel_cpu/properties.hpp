@@ -55,7 +55,9 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  * plugin at the model compilation stage and store non-zero values in a special packed format. Then, during the
  * execution of the model, the weights are unpacked and used in the computational kernel. Since the weights are loaded
  * from DDR/L3 cache in the packed format this significantly decreases memory consumption and as a consequence improve
- * inference performance. The following code allows to set the sparse rate value.
+ * inference performance. The int8 weights are packed on the platforms with AMX, the fp32 weights of the layers without
+ * fused operations are packed in the CSR format and multiplied by the sparse kernel on any platform. The feature is
+ * disabled by default (the rate 1.0). The following code allows to set the sparse rate value.
  *
  * @code
  * core.set_property(ov::intel_cpu::sparse_weights_decompression_rate(0.8));
@@ -63,5 +65,161 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines a set of static input shapes (shape buckets) a dynamic model is additionally compiled for
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Dynamic models can't benefit from the optimizations which require the shapes to be known at the compilation stage,
+ * like static memory planning or shape specialized kernels. When the model is executed only with a few different input
+ * shapes, these shapes may be passed to the CPU plugin as shape buckets. Then a static graph is compiled for each
+ * bucket (constants and weights are shared between the graphs), and inference requests whose input shapes match one of
+ * the buckets are executed by the corresponding static graph. The rest of the requests are executed by the dynamic
+ * graph. Buckets are separated by semicolons, the input shapes inside a bucket use the "name[d0,d1,...]" format:
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::shape_buckets("input_ids[1,32],attention_mask[1,32];"
+ *                                                               "input_ids[1,64],attention_mask[1,64]"));
+ * @endcode
+ *
+ * The buckets of the static model are used only with ov::intel_cpu::relax_static_inputs.
+ */
+static constexpr Property<std::string> shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief This property allows to serve the static model at the shapes of its buckets without the recompilation
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * With this property set to true, the input dimensions the shape buckets (see ov::intel_cpu::shape_buckets) of the
+ * static model differ in become dynamic in the compiled model, so its inputs report the partial shapes and accept the
+ * shapes of the buckets. The buckets are executed by the static graphs compiled from the model transformed once with
+ * the relaxed shapes, and the graphs share the packed weights. Since the relaxed model loses the optimizations of the
+ * static shapes (e.g. the snippets and the folded shape computations), the original input shapes are executed by the
+ * graph of the model transformed with these shapes, as it's compiled without this property, so the transformations
+ * run twice. The legacy API and the models with memory states keep the static inputs. The default value is false.
+ *
+ * @code
+ * core.compile_model(model_224x224, "CPU", ov::intel_cpu::shape_buckets("image[1,3,320,320];image[1,3,512,512]"),
+ *                    ov::intel_cpu::relax_static_inputs(true));
+ * @endcode
+ */
+static constexpr Property<bool> relax_static_inputs{"CPU_RELAX_STATIC_INPUTS"};
+
+/**
+ * @brief This property defines the maximum number of asynchronous inference requests coalesced into one batched
+ * inference
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When more inference requests are started than there are streams, the requests wait in the streams queue and each of
+ * them is executed with batch 1, which leaves most of the matrix multiplication efficiency unused. With a value greater
+ * than 1 the CPU plugin additionally compiles the model with the batch equal to the property value, and the stream
+ * executes up to that number of the queued requests by one inference of the batched graph. The feature is applied only
+ * to static stateless models with batch 1 in all the inputs and outputs, whose output rows are proven to depend only on
+ * the same rows of the inputs: the model with an operation mixing the batch (e.g. Softmax or MatMul over it) or with
+ * an operation unknown to the check isn't coalesced. The default value is 0 (disabled).
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+ *                                  ov::intel_cpu::max_coalesced_requests(4));
+ * @endcode
+ */
+static constexpr Property<uint32_t> max_coalesced_requests{"CPU_MAX_COALESCED_REQUESTS"};
+
+/**
+ * @brief This property enables the tuning of the streams configuration on the target machine at model compilation
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The number of streams and threads per stream selected by the THROUGHPUT performance hint relies on a static
+ * heuristic of the model memory bandwidth pressure. With this property set to true the CPU plugin additionally compiles
+ * the model for several threads-per-stream candidates, measures the throughput of each of them on synthetic inputs
+ * for a short period of time and keeps the fastest one. The result is stored in the model cache, so the tuning is
+ * performed only once per model when the cache is enabled. The property is applied only to static models compiled
+ * with the THROUGHPUT hint and without an explicitly set number of streams. The default value is false.
+ *
+ * The tuning adds to the compilation time: up to six candidates (the heuristic value and 1, 2, 4, 8 and 16 threads per
+ * stream, those resulting in the same streams are compiled once) are compiled and each of them is inferred for at
+ * least 200 ms after a warm-up round. No new candidate is tried after 2 seconds of the tuning, so the compilation takes
+ * at most about 2 seconds more plus the compilation and the measurement of one more candidate.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+ *                                  ov::intel_cpu::streams_auto_tuning(true));
+ * @endcode
+ */
+static constexpr Property<bool> streams_auto_tuning{"CPU_STREAMS_AUTO_TUNING"};
+
+/**
+ * @brief This property makes the compiled model run on the streams executor shared by all the models of the process
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * By default each compiled model creates its own streams, which are pinned to the same cores as the streams of the
+ * other models, so a process serving many models oversubscribes the cores. With this property set to true the model
+ * registers in the process-wide pool of streams instead. The streams of the pool are configured by the first model
+ * compiled with the property and are shared by the models dynamically: the idle models don't occupy any stream, and
+ * under contention the core time of the streams (the measured duration of the inferences) is shared in proportion to
+ * the weights of ov::hint::model_priority (1 for LOW, 2 for MEDIUM and 4 for HIGH). The model adopts the number of
+ * streams and threads per stream of the pool, its own streams configuration is ignored. The default value is false.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::shared_streams_pool(true),
+ *                                  ov::hint::model_priority(ov::hint::Priority::HIGH));
+ * @endcode
+ */
+static constexpr Property<bool> shared_streams_pool{"CPU_SHARED_STREAMS_POOL"};
+
+/**
+ * @brief This property enables the dynamic quantization of the fp32 fully connected layers
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * With this property set to true the constant weights of the fp32 fully connected layers (including MatMul with
+ * constant weights) are quantized to int8 per output channel at model compilation, and their inputs are quantized to
+ * int8 per row at inference, so the layers run on the int8 GEMM without the model being quantized offline. The layers
+ * with an output channel of the weights which can't be quantized accurately enough (the squared quantization error of
+ * the channel exceeds 1e-3 of its squared norm) or with NaN or infinite weights stay in fp32. The outputs of the input
+ * row with NaN or infinite values are NaN. The property has effect on the platforms with
+ * the int8 dot product instructions (AVX512-VNNI or AVX-VNNI). The default value is false.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::dynamic_quantization(true));
+ * @endcode
+ */
+static constexpr Property<bool> dynamic_quantization{"CPU_DYNAMIC_QUANTIZATION"};
+
+/**
+ * @brief This property enables the prefetching of the weights of the next heavy layer during the execution of the
+ * current one
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The memory bound layers with the large weights (e.g. the fully connected layers of LLM at small batch) wait for their
+ * weights to be streamed from the memory when they start. With this property set to true a helper thread of the
+ * compiled model loads the beginning of the weights of the next such layer into the last level cache while the previous
+ * layers are executed, limited by a half of the cache size. The thread is shared by all the streams, the layer of one
+ * stream supersedes the unfinished layer of another one. It has effect on the models with static shapes only. On Linux
+ * the helper thread may run on any core allowed for the thread compiling the model, but only when the core is idle, so
+ * it doesn't preempt the compute threads: when the streams occupy all the cores, the prefetching has little effect. On
+ * the other systems it's scheduled as a regular thread and may share a core with the compute threads. The default value
+ * is false.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::weights_prefetch(true));
+ * @endcode
+ */
+static constexpr Property<bool> weights_prefetch{"CPU_WEIGHTS_PREFETCH"};
+
+/**
+ * @brief This property enables the graph-wide refinement of the memory formats selected for the layers
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The memory format of each layer is selected according to the formats of its inputs, so a layer may pick the format
+ * which requires the reorders on all of its outputs. With this property set to true the memory bound elementwise
+ * layers (Eltwise, FakeQuantize and the elementwise Subgraphs) are switched to another format supported by the same
+ * implementation if that decreases the estimated amount of the memory moved by the layer and the reorders around it.
+ * The layers whose neighbours don't define their formats yet are left as is. The default value is false.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::refine_memory_formats(true));
+ * @endcode
+ */
+static constexpr Property<bool> refine_memory_formats{"CPU_REFINE_MEMORY_FORMATS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
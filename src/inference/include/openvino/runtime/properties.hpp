@@ -612,6 +612,31 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property limits the total size in bytes of the compiled models stored in ov::cache_dir.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When a new compiled model is cached and the limit is exceeded, the least recently used compiled models are evicted
+ * from the cache directory. The access order is shared by all processes using the same cache directory.
+ * The default value 0 means that the size of the cache is not limited.
+ *
+ * @code
+ * ie.set_property(ov::cache_dir("cache/"), ov::cache_max_size(1024 * 1024 * 1024)); // keep up to 1 GB of models
+ * @endcode
+ */
+static constexpr Property<uint64_t> cache_max_size{"CACHE_MAX_SIZE"};
+
+/**
+ * @brief This property sets the number of the recently loaded compiled models, which the core keeps alive when
+ * ov::cache_dir is enabled. The repeated compile_model calls for such models return the same compiled model without
+ * importing it from the cache directory again.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The models are shared, so changing the properties of the returned compiled model affects all of its users.
+ * The models compiled with the remote context are not kept. The default value 0 disables the in-memory cache.
+ */
+static constexpr Property<uint32_t> cache_in_memory_models{"CACHE_IN_MEMORY_MODELS"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
@@ -13,6 +13,8 @@
 #include "openvino/runtime/iremote_context.hpp"
 #include "openvino/util/file_util.hpp"
 
+#include <thread>
+
 namespace {
 std::string resolve_extension_path(const std::string& path) {
     std::string retvalue;
@@ -116,6 +118,48 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+namespace {
+// Unlike the future of std::async, the returned future doesn't wait for the compilation in its destructor, so the
+// compilation stays asynchronous even if the caller discards the future
+template <typename Compile>
+std::future<CompiledModel> compile_detached(Compile&& compile) {
+    auto promise = std::make_shared<std::promise<CompiledModel>>();
+    auto future = promise->get_future();
+    std::thread([promise, compile]() {
+        try {
+            promise->set_value(compile());
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    }).detach();
+    return future;
+}
+}  // namespace
+
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    auto impl = _impl;
+    return compile_detached([impl, model, device_name, config]() -> CompiledModel {
+        OV_CORE_CALL_STATEMENT({
+            auto exec = impl->compile_model(model, device_name, config);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& model_path,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    auto impl = _impl;
+    return compile_detached([impl, model_path, device_name, config]() -> CompiledModel {
+        OV_CORE_CALL_STATEMENT({
+            auto exec = impl->compile_model(model_path, device_name, config);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
 CompiledModel Core::compile_model(const std::string& model_path, const AnyMap& config) {
     return compile_model(model_path, ov::DEFAULT_DEVICE_NAME, config);
 }
@@ -4,7 +4,9 @@
 
 #include "core_impl.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <sstream>
 
 #include "check_network_batchable.hpp"
 #include "compilation_context.hpp"
@@ -68,6 +70,19 @@ void stripDeviceName(std::string& device, const std::string& substr) {
     }
 }
 
+// The compiled model from the in-memory cache is returned as is, so unlike the blob id, which covers only the
+// properties affecting compilation, the key accounts all the properties and the state of the model file
+std::string get_compiled_models_cache_key(const std::string& blob_id,
+                                          const std::string& model_path,
+                                          const ov::AnyMap& config) {
+    std::stringstream key;
+    key << blob_id << ov::ModelCache::calculate_file_info(model_path);
+    for (const auto& item : config) {
+        key << ';' << item.first << '=' << item.second.as<std::string>();
+    }
+    return key.str();
+}
+
 bool is_virtual_device(const std::string& device_name) {
     return (device_name.find("AUTO") != std::string::npos || device_name.find("MULTI") != std::string::npos ||
             device_name.find("HETERO") != std::string::npos || device_name.find("BATCH") != std::string::npos);
@@ -1001,6 +1016,8 @@ ov::AnyMap ov::CoreImpl::get_supported_property(const std::string& full_device_n
 
     static const std::vector<std::string> core_level_properties = {
         ov::cache_dir.name(),
+        ov::cache_max_size.name(),
+        ov::cache_in_memory_models.name(),
         ov::force_tbb_terminate.name(),
         // auto-batch properties are also treated as core-level
         ov::auto_batch_timeout.name(),
@@ -1174,6 +1191,11 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
         return decltype(ov::force_tbb_terminate)::value_type(flag);
     } else if (name == ov::cache_dir.name()) {
         return ov::Any(coreConfig.get_cache_dir());
+    } else if (name == ov::cache_max_size.name()) {
+        return decltype(ov::cache_max_size)::value_type(coreConfig.get_cache_max_size());
+    } else if (name == ov::cache_in_memory_models.name()) {
+        const auto capacity = coreConfig.get_compiled_models_cache().get_capacity();
+        return decltype(ov::cache_in_memory_models)::value_type(capacity);
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
@@ -1300,6 +1322,17 @@ void ov::CoreImpl::set_property_for_device(const ov::AnyMap& configMap, const st
             if (it != config.end()) {
                 config.erase(it);
             }
+
+            // the limits of the cache are applied to the core config, since they are shared by all the devices
+            ov::AnyMap cache_limits;
+            for (const auto& name : {ov::cache_max_size.name(), ov::cache_in_memory_models.name()}) {
+                it = config.find(name);
+                if (it != config.end()) {
+                    cache_limits.insert(*it);
+                    config.erase(it);
+                }
+            }
+            coreConfig.set_and_update(cache_limits);
         }
 
         auto base_desc = pluginRegistry.find(clearDeviceName);
@@ -1440,11 +1473,29 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
     ov::Plugin& plugin,
     const ov::AnyMap& config,
     const ov::SoPtr<ov::IRemoteContext>& context,
-    std::function<ov::SoPtr<ov::ICompiledModel>()> compile_model_lambda) {
+    std::function<ov::SoPtr<ov::ICompiledModel>()> compile_model_lambda) const {
     ov::SoPtr<ov::ICompiledModel> compiled_model;
     struct HeaderException {};
 
     OPENVINO_ASSERT(cacheContent.cacheManager != nullptr);
+
+    // the models compiled with the remote context are bound to it, so they aren't shared
+    auto& compiled_models_cache = coreConfig.get_compiled_models_cache();
+    std::string compiled_models_cache_key;
+    if (!context && compiled_models_cache.get_capacity() > 0) {
+        try {
+            compiled_models_cache_key =
+                get_compiled_models_cache_key(cacheContent.blobId, cacheContent.modelPath, config);
+        } catch (const std::exception&) {
+            // some of the properties can't be printed, so the model can't be identified
+        }
+        if (!compiled_models_cache_key.empty()) {
+            compiled_model = compiled_models_cache.get(compiled_models_cache_key);
+            if (compiled_model)
+                return compiled_model;
+        }
+    }
+
     try {
         cacheContent.cacheManager->read_cache_entry(cacheContent.blobId, [&](std::istream& networkStream) {
             OV_ITT_SCOPE(FIRST_INFERENCE,
@@ -1484,6 +1535,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
     if (!compiled_model)
         compiled_model = compile_model_lambda();
 
+    if (!compiled_models_cache_key.empty())
+        compiled_models_cache.put(compiled_models_cache_key, compiled_model);
+
     return compiled_model;
 }
 
@@ -1544,18 +1598,36 @@ void ov::CoreImpl::AddExtensionUnsafe(const InferenceEngine::IExtensionPtr& exte
 }
 
 void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
-    auto it = config.find(CONFIG_KEY(CACHE_DIR));
+    auto it = config.find(ov::cache_max_size.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        _cacheMaxSize = it->second.as<uint64_t>();
+        // the cache managers are recreated to apply the new limit to the current cache directories
+        _cacheConfig = CoreConfig::CacheConfig::create(_cacheConfig._cacheDir, _cacheMaxSize);
+        for (auto& deviceCfg : _cacheConfigPerDevice) {
+            deviceCfg.second = CoreConfig::CacheConfig::create(deviceCfg.second._cacheDir, _cacheMaxSize);
+        }
+        config.erase(it);
+    }
+
+    it = config.find(CONFIG_KEY(CACHE_DIR));
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheMaxSize);
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheMaxSize);
         }
         config.erase(it);
     }
 
+    it = config.find(ov::cache_in_memory_models.name());
+    if (it != config.end()) {
+        _compiledModelsCache.set_capacity(it->second.as<uint32_t>());
+        config.erase(it);
+    }
+
     it = config.find(ov::force_tbb_terminate.name());
     if (it != config.end()) {
         auto flag = it->second.as<std::string>() == CONFIG_VALUE(YES) ? true : false;
@@ -1573,7 +1645,7 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir, _cacheMaxSize);
 }
 
 std::string ov::CoreImpl::CoreConfig::get_cache_dir() const {
@@ -1585,6 +1657,51 @@ bool ov::CoreImpl::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+uint64_t ov::CoreImpl::CoreConfig::get_cache_max_size() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cacheMaxSize;
+}
+
+ov::CoreImpl::CompiledModelsCache& ov::CoreImpl::CoreConfig::get_compiled_models_cache() const {
+    return _compiledModelsCache;
+}
+
+void ov::CoreImpl::CompiledModelsCache::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    if (m_models.size() > m_capacity)
+        m_models.resize(m_capacity);
+}
+
+size_t ov::CoreImpl::CompiledModelsCache::get_capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::CompiledModelsCache::get(const std::string& id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = std::find_if(m_models.begin(), m_models.end(), [&](const decltype(m_models)::value_type& item) {
+        return item.first == id;
+    });
+    if (it == m_models.end())
+        return {};
+    m_models.splice(m_models.begin(), m_models, it);
+    return it->second;
+}
+
+void ov::CoreImpl::CompiledModelsCache::put(const std::string& id,
+                                            const ov::SoPtr<ov::ICompiledModel>& compiled_model) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0 || !compiled_model)
+        return;
+    m_models.remove_if([&](const decltype(m_models)::value_type& item) {
+        return item.first == id;
+    });
+    m_models.emplace_front(id, compiled_model);
+    if (m_models.size() > m_capacity)
+        m_models.pop_back();
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config_for_device(
@@ -1593,7 +1710,7 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         auto cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val, get_cache_max_size());
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1611,12 +1728,13 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     }
 }
 
-ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir,
+                                                                                     uint64_t maxSize) {
     std::shared_ptr<ov::ICacheManager> cache_manager = nullptr;
 
     if (!dir.empty()) {
         FileUtils::createDirectoryRecursive(dir);
-        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir, maxSize);
     }
 
     return {dir, cache_manager};
@@ -7,6 +7,7 @@
 #include <cpp/ie_cnn_network.h>
 
 #include <ie_remote_context.hpp>
+#include <list>
 
 #include "any_copy.hpp"
 #include "cache_guard.hpp"
@@ -69,13 +70,32 @@ private:
     bool is_proxy_device(const ov::Plugin& plugin) const;
     bool is_proxy_device(const std::string& dev_name) const;
 
+    /**
+     * @brief Keeps the recently loaded compiled models alive to return them on the repeated compile_model calls
+     * without importing them from the cache (see ov::cache_in_memory_models)
+     */
+    class CompiledModelsCache final {
+    public:
+        void set_capacity(size_t capacity);
+        size_t get_capacity() const;
+
+        ov::SoPtr<ov::ICompiledModel> get(const std::string& id);
+        void put(const std::string& id, const ov::SoPtr<ov::ICompiledModel>& compiled_model);
+
+    private:
+        mutable std::mutex m_mutex;
+        size_t m_capacity = 0;
+        // the most recently used models are at the front
+        std::list<std::pair<std::string, ov::SoPtr<ov::ICompiledModel>>> m_models;
+    };
+
     class CoreConfig final {
     public:
         struct CacheConfig {
             std::string _cacheDir;
             std::shared_ptr<ov::ICacheManager> _cacheManager;
 
-            static CacheConfig create(const std::string& dir);
+            static CacheConfig create(const std::string& dir, uint64_t maxSize = 0);
         };
 
         /**
@@ -91,6 +111,10 @@ private:
 
         bool get_enable_mmap() const;
 
+        uint64_t get_cache_max_size() const;
+
+        CompiledModelsCache& get_compiled_models_cache() const;
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
@@ -99,7 +123,9 @@ private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
+        uint64_t _cacheMaxSize = 0;
         bool _flag_enable_mmap = true;
+        mutable CompiledModelsCache _compiledModelsCache;
     };
 
     struct CacheContent {
@@ -159,12 +185,12 @@ private:
                                                           const ov::SoPtr<ov::IRemoteContext>& context,
                                                           const CacheContent& cacheContent) const;
 
-    static ov::SoPtr<ov::ICompiledModel> load_model_from_cache(
+    ov::SoPtr<ov::ICompiledModel> load_model_from_cache(
         const CacheContent& cacheContent,
         ov::Plugin& plugin,
         const ov::AnyMap& config,
         const ov::SoPtr<ov::IRemoteContext>& context,
-        std::function<ov::SoPtr<ov::ICompiledModel>()> compile_model_lambda);
+        std::function<ov::SoPtr<ov::ICompiledModel>()> compile_model_lambda) const;
 
     bool device_supports_model_caching(const ov::Plugin& plugin) const;
 
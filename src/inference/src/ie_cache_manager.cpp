@@ -0,0 +1,256 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "openvino/util/file_util.hpp"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+#else
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#endif
+
+namespace ov {
+
+namespace {
+
+constexpr const char* blobExt = ".blob";
+
+/**
+ * @brief Exclusive lock of the file shared by all the processes working with the cache directory.
+ * The lock is released on destruction. If the lock file can't be created (e.g. the directory is read-only),
+ * the lock isn't acquired and the caller is expected to skip the protected operation.
+ */
+class FileLock {
+public:
+    explicit FileLock(const std::string& path) {
+#ifdef _WIN32
+        m_handle = CreateFileA(path.c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            if (!LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+                CloseHandle(m_handle);
+                m_handle = INVALID_HANDLE_VALUE;
+            }
+        }
+#else
+        m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0666);
+        if (m_fd >= 0 && ::flock(m_fd, LOCK_EX) != 0) {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+#endif
+    }
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+    ~FileLock() {
+#ifdef _WIN32
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+            CloseHandle(m_handle);
+        }
+#else
+        if (m_fd >= 0) {
+            ::flock(m_fd, LOCK_UN);
+            ::close(m_fd);
+        }
+#endif
+    }
+
+    bool locked() const {
+#ifdef _WIN32
+        return m_handle != INVALID_HANDLE_VALUE;
+#else
+        return m_fd >= 0;
+#endif
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+#else
+    int m_fd = -1;
+#endif
+};
+
+// Atomically replaces the destination file, the readers see either the old or the new file
+bool replaceFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+// The name of the temporary file is unique across the threads and the processes writing to the same directory
+std::string getTempFile(const std::string& fileName) {
+    static std::atomic<uint64_t> counter{0};
+#ifdef _WIN32
+    const auto pid = static_cast<uint64_t>(GetCurrentProcessId());
+#else
+    const auto pid = static_cast<uint64_t>(getpid());
+#endif
+    return fileName + "." + std::to_string(pid) + "_" + std::to_string(counter++) + ".tmp";
+}
+
+uint64_t now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count());
+}
+
+}  // namespace
+
+FileStorageCacheManager::Index FileStorageCacheManager::readIndex() const {
+    Index index;
+    std::ifstream stream(FileUtils::makePath(m_cachePath, std::string("cache.index")));
+    std::string id;
+    IndexEntry entry;
+    while (stream >> id >> entry.size >> entry.lastAccess) {
+        index[id] = entry;
+    }
+    return index;
+}
+
+void FileStorageCacheManager::writeIndex(const Index& index) const {
+    const auto indexFileName = FileUtils::makePath(m_cachePath, std::string("cache.index"));
+    const auto tempFileName = getTempFile(indexFileName);
+    {
+        std::ofstream stream(tempFileName);
+        for (const auto& entry : index) {
+            stream << entry.first << ' ' << entry.second.size << ' ' << entry.second.lastAccess << '\n';
+        }
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tempFileName.c_str());
+            return;
+        }
+    }
+    if (!replaceFile(tempFileName, indexFileName))
+        std::remove(tempFileName.c_str());
+}
+
+void FileStorageCacheManager::updateIndex(const std::function<void(Index&)>& modify) const {
+    if (m_maxSize == 0)
+        return;
+    // the index is best effort: the blobs are still usable if the lock can't be taken
+    FileLock lock(FileUtils::makePath(m_cachePath, std::string("cache.lock")));
+    if (!lock.locked())
+        return;
+    auto index = readIndex();
+    modify(index);
+    writeIndex(index);
+}
+
+void FileStorageCacheManager::evict(Index& index, const std::string& keepId) const {
+    // the blobs written before the size limit was set, or lost from the index, are treated as the oldest ones
+    ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool is_dir) {
+        const auto name = ov::util::get_file_name(file);
+        const auto extLength = std::char_traits<char>::length(blobExt);
+        if (is_dir || name.size() <= extLength || name.compare(name.size() - extLength, extLength, blobExt) != 0)
+            return;
+        const auto id = name.substr(0, name.size() - extLength);
+        if (index.count(id) == 0)
+            index[id] = {static_cast<uint64_t>(std::max<int64_t>(ov::util::file_size(file), 0)), 0};
+    });
+
+    std::vector<Index::iterator> entries;
+    uint64_t totalSize = 0;
+    for (auto it = index.begin(); it != index.end();) {
+        if (!FileUtils::fileExist(getBlobFile(it->first))) {
+            it = index.erase(it);
+            continue;
+        }
+        totalSize += it->second.size;
+        if (it->first != keepId)
+            entries.push_back(it);
+        ++it;
+    }
+    if (totalSize <= m_maxSize)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const Index::iterator& a, const Index::iterator& b) {
+        return a->second.lastAccess < b->second.lastAccess;
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= m_maxSize)
+            break;
+        // the blob may be opened by the other process, then it stays in the cache until the next eviction
+        if (std::remove(getBlobFile(entry->first).c_str()) != 0)
+            continue;
+        totalSize -= entry->second.size;
+        index.erase(entry);
+    }
+}
+
+void FileStorageCacheManager::write_cache_entry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tempFileName = getTempFile(blobFileName);
+    bool written = false;
+    try {
+        std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+        writer(stream);
+        stream.flush();
+        written = stream.good();
+    } catch (...) {
+        std::remove(tempFileName.c_str());
+        throw;
+    }
+    if (!written || !replaceFile(tempFileName, blobFileName)) {
+        std::remove(tempFileName.c_str());
+        return;
+    }
+
+    updateIndex([&](Index& index) {
+        index[id] = {static_cast<uint64_t>(std::max<int64_t>(ov::util::file_size(blobFileName), 0)), now()};
+        evict(index, id);
+    });
+}
+
+void FileStorageCacheManager::read_cache_entry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName)) {
+        {
+            std::ifstream stream(blobFileName, std::ios_base::binary);
+            reader(stream);
+        }
+        updateIndex([&](Index& index) {
+            auto& entry = index[id];
+            entry.size = static_cast<uint64_t>(std::max<int64_t>(ov::util::file_size(blobFileName), 0));
+            entry.lastAccess = now();
+        });
+    }
+}
+
+void FileStorageCacheManager::remove_cache_entry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+    updateIndex([&](Index& index) {
+        index.erase(id);
+    });
+}
+
+}  // namespace ov
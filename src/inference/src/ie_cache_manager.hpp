@@ -11,6 +11,7 @@
 
 #include <fstream>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -75,22 +76,45 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Uses simple file for read/write cached models. The blob is written to a temporary file and renamed to
+ * `<id>.blob` when it is complete, so the concurrent processes sharing the cache directory never read partially
+ * written blobs.
+ *
+ * When the size limit is set, the manager also keeps the `cache.index` file with the sizes and the last access time
+ * of the blobs. The index is modified under the cross-process lock of the `cache.lock` file, and after each write
+ * the least recently used blobs are evicted until the total size of the blobs fits the limit.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
+    struct IndexEntry {
+        uint64_t size;
+        uint64_t lastAccess;
+    };
+    using Index = std::map<std::string, IndexEntry>;
+
     std::string m_cachePath;
+    uint64_t m_maxSize;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    Index readIndex() const;
+    void writeIndex(const Index& index) const;
+    // Applies the modification to the index under the cross-process lock, does nothing if there is no size limit
+    void updateIndex(const std::function<void(Index&)>& modify) const;
+    void evict(Index& index, const std::string& keepId) const;
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Directory of the cache
+     * @param maxSize Limit of the total size of the cached blobs in bytes, 0 means no limit
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, uint64_t maxSize = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_maxSize(maxSize) {}
 
     /**
      * @brief Destructor
@@ -99,24 +123,11 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void write_cache_entry(const std::string& id, StreamWriter writer) override;
 
-    void read_cache_entry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void read_cache_entry(const std::string& id, StreamReader reader) override;
 
-    void remove_cache_entry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void remove_cache_entry(const std::string& id) override;
 };
 
 }  // namespace ov
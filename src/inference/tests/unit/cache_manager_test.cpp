@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace ov;
+using namespace ::testing;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+
+    void SetUp() override {
+        m_cacheDir = ov::test::utils::generateTestFilePrefix() + "_cache_manager";
+        ov::test::utils::createDirectory(m_cacheDir);
+    }
+
+    void TearDown() override {
+        for (const auto& ext : {"blob", "index", "lock", "tmp"})
+            ov::test::utils::removeFilesWithExt(m_cacheDir, ext);
+        ov::test::utils::removeDir(m_cacheDir);
+    }
+
+    std::shared_ptr<ICacheManager> makeManager(uint64_t maxSize = 0) const {
+        return std::make_shared<FileStorageCacheManager>(m_cacheDir, maxSize);
+    }
+
+    std::string blobFile(const std::string& id) const {
+        return FileUtils::makePath(m_cacheDir, id + ".blob");
+    }
+
+    std::string indexFile() const {
+        return FileUtils::makePath(m_cacheDir, std::string("cache.index"));
+    }
+
+    static void write(ICacheManager& manager, const std::string& id, const std::string& content) {
+        manager.write_cache_entry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    static std::string read(ICacheManager& manager, const std::string& id) {
+        std::string content;
+        manager.read_cache_entry(id, [&](std::istream& stream) {
+            std::stringstream buffer;
+            buffer << stream.rdbuf();
+            content = buffer.str();
+        });
+        return content;
+    }
+
+    std::vector<std::string> readIndexIds() const {
+        std::vector<std::string> ids;
+        std::ifstream stream(indexFile());
+        std::string id;
+        uint64_t size, lastAccess;
+        while (stream >> id >> size >> lastAccess)
+            ids.push_back(id);
+        return ids;
+    }
+
+    // the last access time of the index is measured in microseconds, the accesses of the test must be distinguishable
+    static void nextAccess() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, noIndexWithoutSizeLimit) {
+    auto manager = makeManager();
+    write(*manager, "a", std::string(100, 'a'));
+    EXPECT_EQ(read(*manager, "a"), std::string(100, 'a'));
+    EXPECT_FALSE(FileUtils::fileExist(indexFile()));
+    EXPECT_FALSE(FileUtils::fileExist(FileUtils::makePath(m_cacheDir, std::string("cache.lock"))));
+    EXPECT_TRUE(ov::test::utils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, leastRecentlyUsedBlobIsEvicted) {
+    auto manager = makeManager(250);
+    write(*manager, "a", std::string(100, 'a'));
+    nextAccess();
+    write(*manager, "b", std::string(100, 'b'));
+    nextAccess();
+    // the read makes "a" more recently used than "b"
+    EXPECT_EQ(read(*manager, "a"), std::string(100, 'a'));
+    nextAccess();
+    write(*manager, "c", std::string(100, 'c'));
+
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("a")));
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("b")));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("c")));
+    EXPECT_EQ(readIndexIds(), (std::vector<std::string>{"a", "c"}));
+}
+
+TEST_F(FileStorageCacheManagerTests, blobLargerThanLimitIsKept) {
+    auto manager = makeManager(50);
+    write(*manager, "a", std::string(40, 'a'));
+    nextAccess();
+    write(*manager, "b", std::string(100, 'b'));
+    // the blob just written is never evicted, even if it doesn't fit the limit alone
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("a")));
+    EXPECT_EQ(read(*manager, "b"), std::string(100, 'b'));
+}
+
+TEST_F(FileStorageCacheManagerTests, indexIsPersistent) {
+    {
+        auto manager = makeManager(250);
+        write(*manager, "a", std::string(100, 'a'));
+        nextAccess();
+        write(*manager, "b", std::string(100, 'b'));
+        nextAccess();
+        EXPECT_EQ(read(*manager, "a"), std::string(100, 'a'));
+    }
+    EXPECT_EQ(readIndexIds(), (std::vector<std::string>{"a", "b"}));
+
+    // the new manager (e.g. of the next process) continues with the access times recorded by the previous one
+    nextAccess();
+    auto manager = makeManager(250);
+    write(*manager, "c", std::string(100, 'c'));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("a")));
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("b")));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("c")));
+}
+
+TEST_F(FileStorageCacheManagerTests, blobsMissingFromIndexAreEvictedFirst) {
+    // the blob written before the size limit was set
+    write(*makeManager(), "old", std::string(100, 'o'));
+    nextAccess();
+    auto manager = makeManager(250);
+    write(*manager, "a", std::string(100, 'a'));
+    nextAccess();
+    write(*manager, "b", std::string(100, 'b'));
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("old")));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("a")));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("b")));
+}
+
+TEST_F(FileStorageCacheManagerTests, removedBlobIsRemovedFromIndex) {
+    auto manager = makeManager(1000);
+    write(*manager, "a", std::string(100, 'a'));
+    write(*manager, "b", std::string(100, 'b'));
+    manager->remove_cache_entry("a");
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("a")));
+    EXPECT_EQ(readIndexIds(), (std::vector<std::string>{"b"}));
+}
+
+TEST_F(FileStorageCacheManagerTests, failedWriteKeepsPreviousBlob) {
+    auto manager = makeManager(1000);
+    write(*manager, "a", std::string(100, 'a'));
+    EXPECT_THROW(manager->write_cache_entry("a",
+                                            [](std::ostream& stream) {
+                                                stream << std::string(50, 'x');
+                                                throw std::runtime_error("export failed");
+                                            }),
+                 std::runtime_error);
+    // the partially written blob never replaces the complete one and its temporary file is removed
+    EXPECT_EQ(read(*manager, "a"), std::string(100, 'a'));
+    EXPECT_TRUE(ov::test::utils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, concurrentReadersSeeCompleteBlobs) {
+    const size_t blobSize = 1 << 20;
+    const std::vector<std::string> contents = {std::string(blobSize, 'a'), std::string(blobSize, 'b')};
+    write(*makeManager(), "blob", contents[0]);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 2; i++) {
+        threads.emplace_back([&, i] {
+            auto manager = makeManager();
+            for (size_t j = 0; j < 20; j++)
+                write(*manager, "blob", contents[(i + j) % 2]);
+        });
+    }
+    for (size_t i = 0; i < 2; i++) {
+        threads.emplace_back([&] {
+            auto manager = makeManager();
+            for (size_t j = 0; j < 50; j++) {
+                const auto content = read(*manager, "blob");
+                // the reader sees either the previous or the next blob, never the one being written
+                EXPECT_TRUE(content == contents[0] || content == contents[1]) << "size " << content.size();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_TRUE(ov::test::utils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, concurrentWritersDontLoseIndexEntries) {
+    // each thread has its own manager, i.e. its own lock file handle, as the separate processes have
+    const size_t threadsNum = 8, blobsPerThread = 10;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsNum; i++) {
+        threads.emplace_back([&, i] {
+            auto manager = makeManager(1 << 20);
+            for (size_t j = 0; j < blobsPerThread; j++)
+                write(*manager, std::to_string(i) + "_" + std::to_string(j), std::string(100, 'x'));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // without the lock the concurrent read-modify-write of the index would drop the entries of the other writers
+    const auto ids = readIndexIds();
+    EXPECT_EQ(ids.size(), threadsNum * blobsPerThread);
+    for (const auto& id : ids)
+        EXPECT_TRUE(FileUtils::fileExist(blobFile(id))) << id;
+}
@@ -7,9 +7,29 @@
 #include "async_infer_request.hpp"
 #include "plugin.hpp"
 
+#include <algorithm>
+#include <limits>
+
 // ------------------------------CumuSchedule----------------------------
 namespace ov {
 namespace auto_plugin {
+size_t DeviceLoad::waiting_requests() const {
+    const auto requests = m_running + m_queued + 1;
+    return requests > m_workers ? requests - m_workers : 0;
+}
+
+double DeviceLoad::expected_completion_time() const {
+    if (m_workers == 0)
+        return std::numeric_limits<double>::max();
+    // every worker finishing the inference moves the queue by one request
+    return m_infer_time * (1.0 + static_cast<double>(waiting_requests()) / m_workers);
+}
+
+void DeviceLoad::update_infer_time(double infer_time) {
+    constexpr double smoothing = 0.2;
+    m_infer_time = m_infer_time == 0.0 ? infer_time : m_infer_time + smoothing * (infer_time - m_infer_time);
+}
+
 bool CumuSchedule::select_other_device(const std::string& cur_dev_name) {
     {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -74,6 +94,11 @@ void CumuSchedule::init() {
                 context_ptr->m_worker_name = context_ptr->m_device_info.device_name;
             }
             generate_workers(context_ptr->m_worker_name, context_ptr->m_compiled_model);
+            {
+                std::lock_guard<std::mutex> lock(m_load_mutex);
+                m_device_loads[context_ptr->m_worker_name].m_workers =
+                    m_worker_requests[context_ptr->m_worker_name].size();
+            }
             context_ptr->m_is_already = true;
             // reloadsuccess flag only for m_compile_context[FALLBACKDEVICE]
             context_ptr->m_is_reload_success = true;
@@ -127,6 +152,8 @@ void CumuSchedule::init() {
         // initialize containers before run async task, if not initialized, it will hang during infer
         m_idle_worker_requests[device.device_name];
         m_worker_requests[device.device_name];
+        m_device_loads[device.device_name];
+        m_routed_tasks[device.device_name] = std::unique_ptr<TaskQueue>(new TaskQueue);
         m_infer_pipeline_tasks_device_specific[device.device_name] = nullptr;
     }
     // load devices other than CPU first
@@ -217,23 +244,145 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         devices = m_context->m_device_priorities;
     }
     lock.unlock();
-    for (auto&& device : devices) {
-        if (!preferred_device.empty() && (device.device_name != preferred_device)) {
-            continue;
+    if (!preferred_device.empty()) {
+        if (deviceChecker().check_if_device_in_list<DeviceInformation>(preferred_device, devices, true) &&
+            run_on_device(pipeline_task, preferred_device, preferred_device)) {
+            return true;
         }
-        if (run_pipeline_task(pipeline_task, m_idle_worker_requests[device.device_name], preferred_device)) {
+        m_infer_pipeline_tasks_device_specific[preferred_device]->push(std::move(pipeline_task));
+        return false;
+    }
+    // the request goes to the device which is expected to complete it first, the devices are tried in the priority
+    // order until they report the inference time
+    struct Candidate {
+        double completion_time;
+        size_t waiting_requests;
+        const DeviceName* device;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(devices.size());
+    {
+        std::lock_guard<std::mutex> load_lock(m_load_mutex);
+        for (auto&& device : devices) {
+            const auto& load = m_device_loads[device.device_name];
+            candidates.push_back({load.expected_completion_time(), load.waiting_requests(), &device.device_name});
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.completion_time < b.completion_time ||
+               (a.completion_time == b.completion_time && a.waiting_requests < b.waiting_requests);
+    });
+    for (auto&& candidate : candidates) {
+        if (run_on_device(pipeline_task, *candidate.device, preferred_device)) {
             return true;
         }
+        if (queue_to_device(pipeline_task, *candidate.device)) {
+            return false;
+        }
     }
-    // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty()) {
-        m_infer_pipeline_tasks_device_specific[preferred_device]->push(std::move(pipeline_task));
-    } else {
-        m_infer_pipeline_tasks.push(std::move(pipeline_task));
+    // no vacant requests and the queues of all the devices are full, storing the task to the common queue
+    m_infer_pipeline_tasks.push(std::move(pipeline_task));
+    return false;
+}
+
+bool CumuSchedule::run_on_device(ov::threading::Task& pipeline_task,
+                                 const DeviceName& device,
+                                 const DeviceName& preferred_device) {
+    // counted before the task runs, as the inference may finish before run_pipeline_task returns
+    {
+        std::lock_guard<std::mutex> lock(m_load_mutex);
+        m_device_loads[device].m_running++;
     }
+    if (run_pipeline_task(pipeline_task, m_idle_worker_requests[device], preferred_device)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(m_load_mutex);
+    m_device_loads[device].m_running--;
     return false;
 }
 
+bool CumuSchedule::queue_to_device(ov::threading::Task& pipeline_task, const DeviceName& device) {
+    {
+        std::lock_guard<std::mutex> lock(m_load_mutex);
+        auto& load = m_device_loads[device];
+        if (!load.can_queue()) {
+            return false;
+        }
+        load.m_queued++;
+    }
+    m_routed_tasks[device]->push(std::move(pipeline_task));
+    // the workers may have become idle before the task was queued, so they haven't picked the task up
+    for (auto&& routed_tasks : m_routed_tasks) {
+        on_worker_idle(routed_tasks.first);
+    }
+    return true;
+}
+
+bool CumuSchedule::pop_routed_task(const DeviceName& device, ov::threading::Task& pipeline_task) {
+    if (!m_routed_tasks[device]->try_pop(pipeline_task)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_load_mutex);
+    m_device_loads[device].m_queued--;
+    return true;
+}
+
+void CumuSchedule::on_worker_idle(const DeviceName& device) {
+    {
+        // the device failed the inference and has been removed by the runtime fallback
+        std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
+        if (!deviceChecker().check_if_device_in_list<DeviceInformation>(device, m_context->m_device_priorities, true)) {
+            return;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_load_mutex);
+        const auto& load = m_device_loads[device];
+        if (load.m_running >= load.m_workers) {
+            return;
+        }
+    }
+    // the requests routed to the device go first, then the ones waiting for the other devices: the idle device takes
+    // them over, so no device idles while the requests wait in the queues
+    auto run_routed_tasks_of = [&](const DeviceName& source) {
+        ov::threading::Task task;
+        while (pop_routed_task(source, task)) {
+            if (!run_on_device(task, device, "")) {
+                // the workers of the device have got busy meanwhile, the task waits for the next idle one
+                {
+                    std::lock_guard<std::mutex> lock(m_load_mutex);
+                    m_device_loads[source].m_queued++;
+                }
+                m_routed_tasks[source]->push(std::move(task));
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!run_routed_tasks_of(device)) {
+        return;
+    }
+    for (auto&& routed_tasks : m_routed_tasks) {
+        if (routed_tasks.first != device && !run_routed_tasks_of(routed_tasks.first)) {
+            return;
+        }
+    }
+}
+
+void CumuSchedule::on_worker_infer_finished(const DeviceName& device, const WorkerInferRequest& worker_request) {
+    const std::chrono::duration<double, std::milli> infer_time =
+        std::chrono::steady_clock::now() - worker_request.m_infer_start_time;
+    std::lock_guard<std::mutex> lock(m_load_mutex);
+    auto& load = m_device_loads[device];
+    if (load.m_running > 0) {
+        load.m_running--;
+    }
+    // the failed inference doesn't tell how fast the device is
+    if (worker_request.m_exception_ptr == nullptr) {
+        load.update_infer_time(infer_time.count());
+    }
+}
+
 CumuSchedule::~CumuSchedule() {
     if (m_context) {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -11,6 +11,26 @@
 namespace ov {
 namespace auto_plugin {
 
+/**
+ * @brief The load of the device which is used to route the requests in the CUMULATIVE_THROUGHPUT mode
+ */
+struct DeviceLoad {
+    // the expected time (ms) the new request takes to complete on the device, including the wait for a free worker
+    double expected_completion_time() const;
+    // the number of the requests the new one waits for before it gets a free worker
+    size_t waiting_requests() const;
+    bool can_queue() const {
+        return m_queued < m_workers;
+    }
+    void update_infer_time(double infer_time);
+
+    size_t m_workers = 0;
+    size_t m_running = 0;
+    size_t m_queued = 0;
+    // the moving average of the inference time (ms), 0 until the first inference on the device finishes
+    double m_infer_time = 0.0;
+};
+
 class CumuSchedule : public Schedule {
 public:
     using Ptr = std::shared_ptr<CumuSchedule>;
@@ -24,6 +44,17 @@ private:
     bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") override;
     void try_to_compile_model(AutoCompileContext& context, const std::shared_ptr<ov::Model>& model) override;
     bool select_other_device(const std::string& cur_dev_name) override;
+    void on_worker_infer_finished(const DeviceName& device, const WorkerInferRequest& worker_request) override;
+    bool run_on_device(ov::threading::Task& pipeline_task, const DeviceName& device, const DeviceName& preferred_device);
+    bool queue_to_device(ov::threading::Task& pipeline_task, const DeviceName& device);
+    bool pop_routed_task(const DeviceName& device, ov::threading::Task& pipeline_task);
+    void on_worker_idle(const DeviceName& device) override;
+
+    std::mutex                                  m_load_mutex;
+    DeviceMap<DeviceLoad>                       m_device_loads;
+    // the requests routed to the device by the expected completion time, unlike the requests of the preferred device
+    // they are run by any device which becomes idle
+    DeviceMap<std::unique_ptr<TaskQueue>>       m_routed_tasks;
 };
 } // namespace auto_plugin
 } // namespace ov
@@ -103,6 +103,7 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
             [worker_request_ptr, this, device, idle_workerrequests_ptr](std::exception_ptr exception_ptr) mutable {
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{worker_request_ptr, *idle_workerrequests_ptr};
                 worker_request_ptr->m_exception_ptr = std::move(exception_ptr);
+                on_worker_infer_finished(device, *worker_request_ptr);
                 {
                     auto stop_retry_and_continue = [worker_request_ptr]() {
                         auto captured_task = std::move(worker_request_ptr->m_task);
@@ -139,6 +140,7 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
                         do {
                             m_infer_pipeline_tasks_device_specific[device]->try_pop(t);
                         } while (t && schedule_to_worker_infer_request(std::move(t), device));
+                        on_worker_idle(device);
                     }
                 }
             });
@@ -34,6 +34,10 @@ protected:
     virtual bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") = 0;
     virtual bool select_other_device(const std::string& cur_dev_name) = 0;
     virtual SoCompiledModel wait_first_compiled_model_ready() = 0;
+    // called when the worker request of the device finishes the inference, before it runs the rest of the pipeline
+    virtual void on_worker_infer_finished(const DeviceName& /*device*/, const WorkerInferRequest& /*worker_request*/) {}
+    // called when the worker request of the device becomes idle and the common and the device queues are empty
+    virtual void on_worker_idle(const DeviceName& /*device*/) {}
     std::string get_log_tag() const noexcept;
     std::shared_ptr<ov::threading::IStreamsExecutor>                     m_executor;
     DeviceMap<NotBusyPriorityWorkerRequests>                             m_idle_worker_requests;
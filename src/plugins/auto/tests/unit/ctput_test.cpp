@@ -3,6 +3,11 @@
 //
 
 #include "include/auto_unit_test.hpp"
+#include "cumulative_schedule.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 using namespace ov::mock_auto_plugin;
 using Config = std::map<std::string, std::string>;
@@ -206,3 +211,115 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoCTPUTCallMulti,
                          AutoCTPUTCallMulti,
                          ::testing::ValuesIn(testConfigs_1),
                          AutoCTPUTCallMulti::getTestCaseName);
+
+TEST(CTPUTDeviceLoadTest, BusyFastDeviceIsPreferredUntilItsQueueIsLong) {
+    DeviceLoad fast;
+    fast.m_workers = 2;
+    fast.update_infer_time(2.0);
+    DeviceLoad slow;
+    slow.m_workers = 2;
+    slow.update_infer_time(10.0);
+    EXPECT_LT(fast.expected_completion_time(), slow.expected_completion_time());
+
+    // the busy fast device still completes the request first
+    fast.m_running = 2;
+    EXPECT_EQ(1u, fast.waiting_requests());
+    EXPECT_DOUBLE_EQ(3.0, fast.expected_completion_time());
+    EXPECT_LT(fast.expected_completion_time(), slow.expected_completion_time());
+    EXPECT_TRUE(fast.can_queue());
+
+    fast.m_queued = 2;
+    EXPECT_FALSE(fast.can_queue());
+    fast.m_queued = 1;
+    fast.update_infer_time(2.0);
+    EXPECT_DOUBLE_EQ(4.0, fast.expected_completion_time());
+
+    // the queue is long enough for the idle slow device to complete the request earlier
+    slow.update_infer_time(3.0);
+    EXPECT_EQ(0u, slow.waiting_requests());
+    EXPECT_DOUBLE_EQ(8.6, slow.expected_completion_time());
+    fast.m_infer_time = 6.0;
+    EXPECT_GT(fast.expected_completion_time(), slow.expected_completion_time());
+}
+
+TEST(CTPUTDeviceLoadTest, DeviceWithoutWorkersIsNeverSelected) {
+    DeviceLoad load;
+    EXPECT_EQ(std::numeric_limits<double>::max(), load.expected_completion_time());
+    EXPECT_FALSE(load.can_queue());
+}
+
+// The mock GPU infers 20 times faster than the mock CPU, both have one worker request
+class CTPUTRoutingMockTest : public tests::AutoTest, public ::testing::Test {
+public:
+    static constexpr auto cpuInferTime = std::chrono::milliseconds(200);
+    static constexpr auto gpuInferTime = std::chrono::milliseconds(10);
+
+    void SetUp() override {
+        std::vector<std::string> availableDevs = {"CPU", "GPU"};
+        ON_CALL(*core, get_available_devices()).WillByDefault(Return(availableDevs));
+        ON_CALL(*core, compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                                     ::testing::Matcher<const std::string&>(StrEq(ov::test::utils::DEVICE_CPU)), _))
+            .WillByDefault(Return(mockExeNetwork));
+        ON_CALL(*core, compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                                     ::testing::Matcher<const std::string&>(StrEq(ov::test::utils::DEVICE_GPU)), _))
+            .WillByDefault(Return(mockExeNetworkActual));
+        ON_CALL(*inferReqInternal, infer()).WillByDefault([this]() {
+            std::this_thread::sleep_for(cpuInferTime);
+            cpuInfers++;
+        });
+        ON_CALL(*inferReqInternalActual, infer()).WillByDefault([]() {
+            std::this_thread::sleep_for(gpuInferTime);
+        });
+
+        plugin->set_device_name("AUTO");
+        config.insert(ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT));
+        config.insert(ov::device::priorities("GPU,CPU"));
+        compiledModel = plugin->compile_model(model, config);
+    }
+
+    void TearDown() override {
+        compiledModel.reset();
+    }
+
+    void inferConcurrently(size_t requestsNum) {
+        std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+        for (size_t i = 0; i < requestsNum; i++)
+            requests.push_back(compiledModel->create_infer_request());
+        for (auto& request : requests)
+            request->start_async();
+        for (auto& request : requests)
+            request->wait();
+    }
+
+    std::shared_ptr<ov::ICompiledModel> compiledModel;
+    std::atomic<size_t> cpuInfers{0};
+};
+
+constexpr std::chrono::milliseconds CTPUTRoutingMockTest::cpuInferTime;
+constexpr std::chrono::milliseconds CTPUTRoutingMockTest::gpuInferTime;
+
+TEST_F(CTPUTRoutingMockTest, RequestsFollowExpectedCompletionTime) {
+    // the devices without the inference time are tried in the priority order, so both of them get a request
+    inferConcurrently(2);
+    ASSERT_EQ(cpuInfers.load(), 1u);
+
+    // the request waits for the busy fast device rather than runs on the idle slow one
+    cpuInfers = 0;
+    for (size_t i = 0; i < 5; i++)
+        inferConcurrently(2);
+    EXPECT_EQ(cpuInfers.load(), 0u);
+}
+
+TEST_F(CTPUTRoutingMockTest, IdleDeviceTakesOverQueuedRequests) {
+    inferConcurrently(2);
+    ASSERT_EQ(cpuInfers.load(), 1u);
+
+    // the queues of both devices are filled up, the fast device runs the request queued for the slow one as soon as it
+    // gets idle, so the burst takes one inference of the slow device rather than two
+    cpuInfers = 0;
+    const auto start = std::chrono::steady_clock::now();
+    inferConcurrently(8);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LE(cpuInfers.load(), 1u);
+    EXPECT_LT(elapsed, 2 * cpuInferTime);
+}
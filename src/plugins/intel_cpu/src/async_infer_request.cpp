@@ -3,13 +3,39 @@
 //
 
 #include "async_infer_request.h"
+#include "requests_coalescer.h"
+#include <threading/ie_immediate_executor.hpp>
 #include <memory>
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _request(static_cast<InferRequestBase*>(inferRequest.get())) {
+    auto request = _request;
+    request->SetAsyncRequest(this);
+
+    // the request is enqueued when it is started, so the stream which reaches the first of the queued requests
+    // can infer the compatible ones together with it. The request taken into the batch of another stream releases
+    // its own stream at once and is completed by the stream of the batch.
+    if (auto coalescer = request->GetRequestsCoalescer()) {
+        _pipeline = {{std::make_shared<InferenceEngine::ImmediateExecutor>(), [request, coalescer] {
+                          coalescer->Enqueue(request);
+                      }},
+                     {taskExecutor, [request, coalescer] {
+                          coalescer->Infer(request);
+                      }},
+                     {coalescer->GetCompletionExecutor(request), [request, coalescer] {
+                          coalescer->Complete(request);
+                      }}};
+    }
+}
+
+void ov::intel_cpu::AsyncInferRequest::Cancel() {
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::Cancel();
+    // the cancelled request is never taken into a batch, its own stream throws the cancellation
+    if (auto coalescer = _request->GetRequestsCoalescer())
+        coalescer->Remove(_request);
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
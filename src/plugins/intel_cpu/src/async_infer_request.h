@@ -18,6 +18,11 @@ public:
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~AsyncInferRequest();
+
+    void Cancel() override;
+
+private:
+    InferRequestBase* _request;
 };
 
 }   // namespace intel_cpu
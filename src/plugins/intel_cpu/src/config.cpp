@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "cpu/cpu_config.hpp"
@@ -17,6 +18,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "utils/debug_capabilities.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -69,6 +71,59 @@ void Config::applyDebugCapsProperties() {
 }
 #endif
 
+// parses the shape buckets in "name[d0,d1,...],name2[d0,...];name[d0,d1,...],..." format
+static std::vector<std::map<std::string, std::vector<size_t>>> parseShapeBuckets(const std::string& val) {
+    const auto throwWrongValue = [&val]() {
+        IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::shape_buckets.name()
+                   << ". Expected format: name[d0,d1,...],name2[d0,...];name[d0,d1,...],...";
+    };
+
+    std::vector<std::map<std::string, std::vector<size_t>>> buckets;
+    std::istringstream bucketsStream(val);
+    std::string bucketStr;
+    while (std::getline(bucketsStream, bucketStr, ';')) {
+        if (ov::util::trim(bucketStr).empty())
+            continue;
+
+        std::map<std::string, std::vector<size_t>> bucket;
+        size_t pos = 0;
+        while (pos < bucketStr.size()) {
+            const auto begin = bucketStr.find('[', pos);
+            const auto end = bucketStr.find(']', pos);
+            if (begin == std::string::npos || end == std::string::npos || end < begin)
+                throwWrongValue();
+
+            const auto name = ov::util::trim(bucketStr.substr(pos, begin - pos));
+            if (name.empty() || bucket.count(name))
+                throwWrongValue();
+
+            std::vector<size_t> dims;
+            std::istringstream dimsStream(bucketStr.substr(begin + 1, end - begin - 1));
+            std::string dimStr;
+            while (std::getline(dimsStream, dimStr, ',')) {
+                try {
+                    const auto dim = std::stoll(dimStr);
+                    if (dim < 0)
+                        throwWrongValue();
+                    dims.push_back(static_cast<size_t>(dim));
+                } catch (const std::logic_error&) {
+                    throwWrongValue();
+                }
+            }
+            bucket[name] = dims;
+
+            pos = bucketStr.find_first_not_of(" \t", end + 1);
+            if (pos != std::string::npos) {
+                if (bucketStr[pos] != ',')
+                    throwWrongValue();
+                pos++;
+            }
+        }
+        buckets.push_back(bucket);
+    }
+    return buckets;
+}
+
 void Config::readProperties(const std::map<std::string, std::string> &prop, ModelType modelType) {
     const auto streamExecutorConfigKeys = streamExecutorConfig.SupportedKeys();
     const auto hintsConfigKeys = perfHintsConfig.SupportedKeys();
@@ -129,6 +184,84 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, Mode
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == ov::intel_cpu::shape_buckets.name()) {
+            shapeBuckets = parseShapeBuckets(val);
+            shapeBucketsStr = val;
+        } else if (key == ov::intel_cpu::max_coalesced_requests.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::max_coalesced_requests.name()
+                           << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::max_coalesced_requests.name()
+                           << ". Expected only non negative integer numbers";
+            }
+            maxCoalescedRequests = static_cast<size_t>(val_i);
+        } else if (key == ov::intel_cpu::streams_auto_tuning.name()) {
+            if (val == PluginConfigParams::YES) {
+                streamsAutoTuning = true;
+            } else if (val == PluginConfigParams::NO) {
+                streamsAutoTuning = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::streams_auto_tuning.name()
+                           << ". Expected only true/false";
+            }
+        } else if (key == ov::intel_cpu::shared_streams_pool.name()) {
+            if (val == PluginConfigParams::YES) {
+                sharedStreamsPool = true;
+            } else if (val == PluginConfigParams::NO) {
+                sharedStreamsPool = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::shared_streams_pool.name()
+                           << ". Expected only true/false";
+            }
+        } else if (key == ov::intel_cpu::dynamic_quantization.name()) {
+            if (val == PluginConfigParams::YES) {
+                fcDynamicQuantization = true;
+            } else if (val == PluginConfigParams::NO) {
+                fcDynamicQuantization = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::dynamic_quantization.name()
+                           << ". Expected only true/false";
+            }
+        } else if (key == ov::intel_cpu::weights_prefetch.name()) {
+            if (val == PluginConfigParams::YES) {
+                weightsPrefetch = true;
+            } else if (val == PluginConfigParams::NO) {
+                weightsPrefetch = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::weights_prefetch.name()
+                           << ". Expected only true/false";
+            }
+        } else if (key == ov::intel_cpu::refine_memory_formats.name()) {
+            if (val == PluginConfigParams::YES) {
+                refineMemoryFormats = true;
+            } else if (val == PluginConfigParams::NO) {
+                refineMemoryFormats = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::refine_memory_formats.name()
+                           << ". Expected only true/false";
+            }
+        } else if (key == ov::intel_cpu::relax_static_inputs.name()) {
+            if (val == PluginConfigParams::YES) {
+                relaxStaticInputs = true;
+            } else if (val == PluginConfigParams::NO) {
+                relaxStaticInputs = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::relax_static_inputs.name()
+                           << ". Expected only true/false";
+            }
+        } else if (key == ov::hint::model_priority.name()) {
+            try {
+                modelPriority = ov::util::from_string(val, ov::hint::model_priority);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::hint::model_priority.name()
+                           << ". Expected only " << ov::hint::Priority::LOW << "/" << ov::hint::Priority::MEDIUM << "/"
+                           << ov::hint::Priority::HIGH;
+            }
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -16,6 +16,7 @@
 #include <string>
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -56,6 +57,24 @@ struct Config {
     std::string dumpToDot = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
+    // static input shapes (input name -> dims) the dynamic model is additionally compiled for
+    std::vector<std::map<std::string, std::vector<size_t>>> shapeBuckets;
+    std::string shapeBucketsStr = {};
+    // relax the input dimensions the shape buckets of the static model differ in
+    bool relaxStaticInputs = false;
+    // the batch of the graph the queued inference requests are coalesced into (0 and 1 disable the coalescing)
+    size_t maxCoalescedRequests = 0;
+    // measure several streams configurations at compilation and keep the fastest one (THROUGHPUT hint only)
+    bool streamsAutoTuning = false;
+    // run the inference on the process-wide streams executor shared with the other models
+    bool sharedStreamsPool = false;
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
+    // quantize the weights of the fp32 fully connected layers to int8 and their inputs at runtime
+    bool fcDynamicQuantization = false;
+    // load the weights of the next heavy node into the cache while the previous nodes are executed
+    bool weightsPrefetch = false;
+    // switch the elementwise nodes to the memory formats decreasing the reorders around them
+    bool refineMemoryFormats = false;
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
@@ -16,6 +19,12 @@ namespace intel_cpu {
 class DnnlScratchPad {
     MemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    // the nodes may request the scratchpad concurrently when their primitives are created in parallel, and the nodes
+    // of the dynamic graph are prepared while the previous ones are executed (see Graph::InferDynamic)
+    std::mutex mutex;
+    std::condition_variable executionDone;
+    size_t size = 0;
+    std::thread::id executingThread;
 
 public:
     DnnlScratchPad(dnnl::engine eng) : eng(eng) {
@@ -23,9 +32,47 @@ public:
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        std::unique_lock<std::mutex> lock(mutex);
+        // the memory only grows, and growing reallocates it, so it waits for the node using the scratchpad, unless the
+        // node itself prepares its params while executed
+        const auto memSize = md->getCurrentMemSize();
+        if (memSize > size) {
+            executionDone.wait(lock, [this] {
+                return executingThread == std::thread::id() || executingThread == std::this_thread::get_id();
+            });
+            size = memSize;
+        }
         auto mem = std::make_shared<Memory>(eng, md, mgrPtr);
         return mem;
     }
+
+    /**
+     * @brief Marks the scratchpad as used by the executed node, so it isn't reallocated while the guard exists. The
+     * scratchpad memory which fits the current size is created without waiting for the guard.
+     */
+    class ExecutionGuard {
+    public:
+        ExecutionGuard(DnnlScratchPad& scratchPad, bool enabled) : scratchPad(enabled ? &scratchPad : nullptr) {
+            if (this->scratchPad) {
+                std::lock_guard<std::mutex> lock(this->scratchPad->mutex);
+                this->scratchPad->executingThread = std::this_thread::get_id();
+            }
+        }
+        ~ExecutionGuard() {
+            if (scratchPad) {
+                {
+                    std::lock_guard<std::mutex> lock(scratchPad->mutex);
+                    scratchPad->executingThread = std::thread::id();
+                }
+                scratchPad->executionDone.notify_all();
+            }
+        }
+        ExecutionGuard(const ExecutionGuard&) = delete;
+        ExecutionGuard& operator=(const ExecutionGuard&) = delete;
+
+    private:
+        DnnlScratchPad* scratchPad;
+    };
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
@@ -9,12 +9,15 @@
 
 #include "async_infer_request.h"
 #include "infer_request.h"
+#include "requests_coalescer.h"
+#include "shared_streams_pool.h"
 #include "memory_state.h"
 #include "itt.h"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
+#include "onednn/dnnl.h"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -23,6 +26,7 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/op/util/read_value_base.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
@@ -66,12 +70,15 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const InferenceEngine::CNNNetwork &staticNetwork) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _stateBlockPool{std::make_shared<StateBlockPool>()},
+    _staticNetwork(staticNetwork) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -97,11 +104,20 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                                                                                       isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
         _cfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
+        if (_cfg.sharedStreamsPool) {
+            // the graphs are created per stream of the pool, so the model adopts the streams of the pool
+            const auto pool = SharedStreamsPool::Get(streamsExecutorConfig);
+            _cfg.streamExecutorConfig._streams = pool->GetConfig()._streams;
+            _cfg.streamExecutorConfig._threadsPerStream = pool->GetConfig()._threadsPerStream;
+            _cfg.streamExecutorConfig._threads = pool->GetConfig()._threads;
+            _taskExecutor = pool->RegisterModel(_cfg.modelPriority);
+        } else {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-        _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
+            _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+            _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
 #endif
+        }
     }
     if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -114,25 +130,44 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (_cfg.weightsPrefetch) {
+        // created here rather than by the graphs, so the helper thread isn't pinned to the cores of a stream;
+        // the loaded weights mustn't evict the data of the nodes executed meanwhile
+        const size_t llcSize = dnnl::utils::get_cache_size(3, false);
+        const size_t l2Size = dnnl::utils::get_cache_size(2, true);
+        _weightsPrefetcher = std::make_shared<WeightsPrefetcher>(llcSize ? llcSize / 2 : l2Size);
+    }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    CreateShapeBuckets();
+    CreateRequestsCoalescer();
+    auto create_graphs = [this] {
+        ExecNetwork::GetGraph();
+        for (const auto& bucket : _shapeBuckets)
+            ExecNetwork::GetGraph(bucket.graphs, bucket.network);
+        if (_requestsCoalescer)
+            ExecNetwork::GetGraph(_coalescedGraphs, _coalescedNetwork);
+    };
     if (_cfg.streamExecutorConfig._streams != 0) {
         auto all_graphs_ready = [&] {
-            return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
+            auto ready = [&] (Graph& graph) {
                 return graph.IsReady();
-            });
+            };
+            return std::all_of(_graphs.begin(), _graphs.end(), ready) &&
+                   std::all_of(_coalescedGraphs.begin(), _coalescedGraphs.end(), ready) &&
+                   std::all_of(_shapeBuckets.begin(), _shapeBuckets.end(), [&] (const ShapeBucket& bucket) {
+                       return std::all_of(bucket.graphs.begin(), bucket.graphs.end(), ready);
+                   });
         };
         do {
             for (auto&& task : tasks) {
-                task = [this] {
-                    ExecNetwork::GetGraph();
-                };
+                task = create_graphs;
             }
             _taskExecutor->runAndWait(tasks);
         } while (!all_graphs_ready());
     } else {
-        ExecNetwork::GetGraph();
+        create_graphs();
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -153,13 +188,152 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name, state_store, _stateBlockPool));
             }
         }
     }
 }
 
+void ExecNetwork::CreateShapeBuckets() {
+    const auto function = _network.getFunction();
+    if (_cfg.shapeBuckets.empty())
+        return;
+
+    for (const auto& bucketDims : _cfg.shapeBuckets) {
+        for (const auto& dims : bucketDims) {
+            const auto& params = function->get_parameters();
+            const bool known = std::any_of(params.begin(), params.end(), [&](const std::shared_ptr<ov::op::v0::Parameter>& param) {
+                return param->get_friendly_name() == dims.first || param->get_output_tensor(0).get_names().count(dims.first);
+            });
+            if (!known)
+                IE_THROW() << "Shape bucket defines the shape of the input " << dims.first << " the model doesn't have";
+        }
+    }
+
+    if (!function->is_dynamic())
+        return;
+
+    // memory states are stored in the graph, so they can't be shared between the graphs of the different buckets
+    if (ov::op::util::has_op_with_type<ov::op::util::ReadValueBase>(function))
+        return;
+
+    // the original input shapes of the relaxed static model are inferred by the graph compiled with these shapes,
+    // which is the graph of the static model compiled without the relaxation
+    if (_staticNetwork.getFunction()) {
+        _shapeBuckets.emplace_back();
+        auto& bucket = _shapeBuckets.back();
+        bucket.network = _staticNetwork;
+        for (const auto& param : _staticNetwork.getFunction()->get_parameters())
+            bucket.inputDims[param->get_friendly_name()] = param->get_output_shape(0);
+        bucket.graphs.resize(_graphs.size());
+    }
+
+    for (const auto& bucketDims : _cfg.shapeBuckets) {
+        _shapeBuckets.emplace_back();
+        auto& bucket = _shapeBuckets.back();
+        bucket.network = InferenceEngine::details::cloneNetwork(_network);
+        auto bucketFunction = bucket.network.getFunction();
+        for (const auto& param : bucketFunction->get_parameters()) {
+            const auto& name = param->get_friendly_name();
+            const auto& tensorNames = param->get_output_tensor(0).get_names();
+            const auto dims = std::find_if(bucketDims.begin(), bucketDims.end(),
+                                           [&](const std::pair<const std::string, std::vector<size_t>>& item) {
+                                               return item.first == name || tensorNames.count(item.first);
+                                           });
+            const auto& origShape = param->get_output_partial_shape(0);
+            if (dims == bucketDims.end()) {
+                if (origShape.is_dynamic())
+                    IE_THROW() << "Shape bucket doesn't define the shape of the dynamic input " << name;
+                continue;
+            }
+
+            const ov::Shape bucketShape(dims->second);
+            if (!origShape.compatible(bucketShape))
+                IE_THROW() << "Shape bucket defines the shape " << bucketShape << " of the input " << name
+                           << " which is incompatible with the model input shape " << origShape;
+
+            param->set_partial_shape(bucketShape);
+            bucket.inputDims[name] = dims->second;
+        }
+        bucketFunction->validate_nodes_and_infer_types();
+
+        bucket.graphs.resize(_graphs.size());
+    }
+}
+
+void ExecNetwork::CreateRequestsCoalescer() {
+    const auto batch = _cfg.maxCoalescedRequests;
+    const auto function = _network.getFunction();
+    // requests wait in the queue only if they are executed by the streams
+    if (batch <= 1 || _cfg.streamExecutorConfig._streams == 0 || function->is_dynamic() ||
+        ov::op::util::has_op_with_type<ov::op::util::ReadValueBase>(function))
+        return;
+    // the requests of one batch mustn't affect each other (e.g. by Softmax or MatMul over the batch)
+    if (!RequestsCoalescer::IsBatchIndependent(function))
+        return;
+
+    auto hasUnitBatch = [](const ov::Shape& shape) {
+        return !shape.empty() && shape[0] == 1;
+    };
+    for (const auto& param : function->get_parameters()) {
+        if (!hasUnitBatch(param->get_output_shape(0)))
+            return;
+    }
+    for (const auto& result : function->get_results()) {
+        if (!hasUnitBatch(result->get_output_shape(0)))
+            return;
+    }
+
+    auto network = InferenceEngine::details::cloneNetwork(_network);
+    auto batchedFunction = network.getFunction();
+    for (const auto& param : batchedFunction->get_parameters()) {
+        auto shape = param->get_output_shape(0);
+        shape[0] = batch;
+        param->set_partial_shape(shape);
+    }
+    try {
+        batchedFunction->validate_nodes_and_infer_types();
+    } catch (const ov::Exception&) {
+        // the model can't be reshaped to the batch (e.g. the batch is fixed by some constant), keep it unbatched
+        return;
+    }
+
+    // the batch must be propagated through the whole model, so each row of the outputs belongs to one request
+    const auto& origResults = function->get_results();
+    const auto& batchedResults = batchedFunction->get_results();
+    for (size_t i = 0; i < origResults.size(); i++) {
+        auto expected = origResults[i]->get_output_shape(0);
+        expected[0] = batch;
+        if (batchedResults[i]->get_output_partial_shape(0) != ov::PartialShape(expected))
+            return;
+    }
+
+    _coalescedNetwork = network;
+    _coalescedGraphs.resize(_graphs.size());
+    _requestsCoalescer = std::make_shared<RequestsCoalescer>(batch, [this](const std::vector<InferRequestBase*>& requests) {
+        auto graphLock = GetGraph(_coalescedGraphs, _coalescedNetwork);
+        InferRequestBase::InferCoalesced(graphLock._graph, requests);
+    });
+}
+
+std::unique_ptr<ExecNetwork::GraphGuard::Lock> ExecNetwork::GetBucketGraph(const InferenceEngine::BlobMap& inputs) const {
+    for (const auto& bucket : _shapeBuckets) {
+        const bool match = std::all_of(bucket.inputDims.begin(), bucket.inputDims.end(),
+                                       [&](const std::pair<const std::string, InferenceEngine::SizeVector>& item) {
+                                           const auto input = inputs.find(item.first);
+                                           return input != inputs.end() && input->second->getTensorDesc().getDims() == item.second;
+                                       });
+        if (match)
+            return std::unique_ptr<GraphGuard::Lock>(new GraphGuard::Lock(GetGraph(bucket.graphs, bucket.network)));
+    }
+    return nullptr;
+}
+
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
+    return GetGraph(_graphs, _network);
+}
+
+ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph(std::deque<GraphGuard>& graphs, const InferenceEngine::CNNNetwork& network) const {
     int streamId = 0;
     int socketId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
@@ -167,7 +341,7 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
         streamId = streamsExecutor->GetStreamId();
         socketId = streamsExecutor->GetSocketId();
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    auto graphLock = GraphGuard::Lock(graphs[streamId % graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -176,15 +350,18 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     // disable weights caching if graph was created only once
-                    auto weightsCache = _cfg.streamExecutorConfig._streams != 1 ? _socketWeights[socketId] : nullptr;
+                    // (the graphs of the shape buckets and the coalesced graphs share the weights with the main one)
+                    auto weightsCache = _cfg.streamExecutorConfig._streams != 1 || !_shapeBuckets.empty() || _requestsCoalescer
+                                            ? _socketWeights[socketId] : nullptr;
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
-                        ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
+                        ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag,
+                                                         _weightsPrefetcher);
                 }
-                graphLock._graph.CreateGraph(_network, ctx);
+                graphLock._graph.CreateGraph(network, ctx);
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -301,6 +478,15 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::shape_buckets.name()),
+            RO_property(ov::intel_cpu::max_coalesced_requests.name()),
+            RO_property(ov::intel_cpu::streams_auto_tuning.name()),
+            RO_property(ov::intel_cpu::shared_streams_pool.name()),
+            RO_property(ov::hint::model_priority.name()),
+            RO_property(ov::intel_cpu::dynamic_quantization.name()),
+            RO_property(ov::intel_cpu::weights_prefetch.name()),
+            RO_property(ov::intel_cpu::refine_memory_formats.name()),
+            RO_property(ov::intel_cpu::relax_static_inputs.name()),
         };
     }
 
@@ -358,6 +544,24 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::shape_buckets) {
+        return decltype(ov::intel_cpu::shape_buckets)::value_type(config.shapeBucketsStr);
+    } else if (name == ov::intel_cpu::max_coalesced_requests) {
+        return decltype(ov::intel_cpu::max_coalesced_requests)::value_type(config.maxCoalescedRequests);
+    } else if (name == ov::intel_cpu::streams_auto_tuning) {
+        return decltype(ov::intel_cpu::streams_auto_tuning)::value_type(config.streamsAutoTuning);
+    } else if (name == ov::intel_cpu::shared_streams_pool) {
+        return decltype(ov::intel_cpu::shared_streams_pool)::value_type(config.sharedStreamsPool);
+    } else if (name == ov::hint::model_priority) {
+        return decltype(ov::hint::model_priority)::value_type(config.modelPriority);
+    } else if (name == ov::intel_cpu::dynamic_quantization) {
+        return decltype(ov::intel_cpu::dynamic_quantization)::value_type(config.fcDynamicQuantization);
+    } else if (name == ov::intel_cpu::weights_prefetch) {
+        return decltype(ov::intel_cpu::weights_prefetch)::value_type(config.weightsPrefetch);
+    } else if (name == ov::intel_cpu::refine_memory_formats) {
+        return decltype(ov::intel_cpu::refine_memory_formats)::value_type(config.refineMemoryFormats);
+    } else if (name == ov::intel_cpu::relax_static_inputs) {
+        return decltype(ov::intel_cpu::relax_static_inputs)::value_type(config.relaxStaticInputs);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -21,6 +21,9 @@
 namespace ov {
 namespace intel_cpu {
 
+class RequestsCoalescer;
+class StateBlockPool;
+
 class ExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<ExecNetwork> Ptr;
@@ -37,7 +40,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const InferenceEngine::CNNNetwork &staticNetwork = {});
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -58,6 +62,8 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // Blocks the variable states of the requests are stored in
+    std::shared_ptr<StateBlockPool>             _stateBlockPool;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -69,6 +75,19 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable SocketsWeights                      _socketWeights;
+    // Loads the weights of the next heavy node for the graphs of all the streams, see ov::intel_cpu::weights_prefetch
+    WeightsPrefetcher::Ptr                      _weightsPrefetcher;
+
+    // Static graphs compiled for the shape buckets of the dynamic model (or of the static model relaxed by the plugin),
+    // see ov::intel_cpu::shape_buckets and ov::intel_cpu::relax_static_inputs
+    struct ShapeBucket {
+        std::map<std::string, InferenceEngine::SizeVector> inputDims;  // graph input name -> static dims
+        InferenceEngine::CNNNetwork network;
+        mutable std::deque<GraphGuard> graphs;
+    };
+    std::deque<ShapeBucket>                     _shapeBuckets;
+    // The relaxed static model transformed with its original input shapes
+    InferenceEngine::CNNNetwork                 _staticNetwork;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -76,6 +95,22 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    /* Returns the graph in current stream compiled for the shape bucket matching the input blobs dims
+     * or nullptr if there is no such bucket
+     */
+    std::unique_ptr<GraphGuard::Lock> GetBucketGraph(const InferenceEngine::BlobMap& inputs) const;
+
+    GraphGuard::Lock GetGraph(std::deque<GraphGuard>& graphs, const InferenceEngine::CNNNetwork& network) const;
+
+    void CreateShapeBuckets();
+
+    // Graphs compiled with the batch the queued requests are coalesced into, see ov::intel_cpu::max_coalesced_requests
+    InferenceEngine::CNNNetwork                 _coalescedNetwork;
+    mutable std::deque<GraphGuard>              _coalescedGraphs;
+    std::shared_ptr<RequestsCoalescer>          _requestsCoalescer;
+
+    void CreateRequestsCoalescer();
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <functional>
 #include <string>
 #include <map>
 #include <vector>
@@ -13,6 +14,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
+#include <thread>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -44,6 +47,7 @@
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
+#include "onednn/dnnl.h"
 
 #include <openvino/core/model.hpp>
 #include <openvino/core/node.hpp>
@@ -364,6 +368,9 @@ void Graph::InitGraph() {
 
     InitDescriptors();
 
+    if (getConfig().refineMemoryFormats)
+        RefineMemoryFormats();
+
     ResolveInplaceDirections();
 
     InitOptimalPrimitiveDescriptors();
@@ -377,6 +384,14 @@ void Graph::InitGraph() {
 
     Allocate();
 
+    preparationPending = true;
+    if (!lazyPreparation)
+        FinalizePreparation();
+
+    status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
+}
+
+void Graph::FinalizePreparation() {
     CreatePrimitivesAndExecConstants();
 
 #ifndef CPU_DEBUG_CAPS
@@ -386,8 +401,9 @@ void Graph::InitGraph() {
 #endif
 
     ExtractExecutableNodes();
+    InitWeightsPrefetching();
 
-    status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
+    preparationPending = false;
 }
 
 void Graph::InitNodes() {
@@ -443,6 +459,123 @@ void Graph::InitDescriptors() {
     }
 }
 
+/* The primitive descriptors are selected greedily in topological order: each node takes into account only
+ * the memory formats of its parents. This pass (enabled by ov::intel_cpu::refine_memory_formats) revisits the memory
+ * bound elementwise nodes and switches a node to another memory format variant of the same implementation if that
+ * decreases the estimated amount of the memory moved by the node itself and by the reorders on its edges, given the
+ * current selection of the neighbours. The padded size of the blocked formats is taken into account, so the cost
+ * of the node doesn't depend on the format only for the nodes whose kernels just stream the memory. The node is left
+ * as is if a format of its neighbours isn't defined yet. The pass is repeated until no node changes.
+ */
+void Graph::RefineMemoryFormats() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::RefineMemoryFormats");
+
+    auto memSize = [](const PortConfig& portConfig, size_t& size) {
+        const auto& desc = portConfig.getMemDesc();
+        if (!desc || !desc->isDefined())
+            return false;
+        size = desc->getCurrentMemSize();
+        return true;
+    };
+
+    // the amount of memory moved by the reorder which is inserted on the edge if the memory formats don't match,
+    // returns false if the formats aren't known yet (the undefined ones are resolved later according to the neighbours)
+    auto reorderCost = [&](const EdgePtr& edge, const NodeDesc* parentPd, const NodeDesc* childPd, size_t& cost) {
+        cost = 0;
+        // the constants are reordered once at the compilation stage
+        if (edge->getParent()->isConstant())
+            return true;
+        if (!parentPd || !childPd)
+            return false;
+
+        const auto& outConfs = parentPd->getConfig().outConfs;
+        const auto& inConfs = childPd->getConfig().inConfs;
+        const auto inNum = edge->getInputNum();
+        const auto outNum = edge->getOutputNum();
+        if (inNum < 0 || static_cast<size_t>(inNum) >= outConfs.size() ||
+            outNum < 0 || static_cast<size_t>(outNum) >= inConfs.size())
+            return false;
+
+        size_t srcSize = 0, dstSize = 0;
+        if (!memSize(outConfs[inNum], srcSize) || !memSize(inConfs[outNum], dstSize))
+            return false;
+        if (!inConfs[outNum].getMemDesc()->isCompatible(*outConfs[inNum].getMemDesc()))
+            cost = srcSize + dstSize;
+        return true;
+    };
+
+    auto nodeCost = [&](const NodePtr& node, const NodeDesc* pd, size_t& cost) {
+        cost = 0;
+        size_t size = 0;
+        for (const auto& portConfig : pd->getConfig().inConfs) {
+            if (!memSize(portConfig, size))
+                return false;
+            cost += size;
+        }
+        for (const auto& portConfig : pd->getConfig().outConfs) {
+            if (!memSize(portConfig, size))
+                return false;
+            cost += size;
+        }
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            if (!reorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), pd, size))
+                return false;
+            cost += size;
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            if (!reorderCost(edge, pd, edge->getChild()->getSelectedPrimitiveDescriptor(), size))
+                return false;
+            cost += size;
+        }
+        return true;
+    };
+
+    // the nodes whose kernels stream the memory, so their cost is defined by the amount of the memory they move
+    auto isRefinable = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::Eltwise, Type::FakeQuantize);
+    };
+
+    constexpr size_t maxIterations = 4;
+    for (size_t iteration = 0; iteration < maxIterations; iteration++) {
+        bool changed = false;
+        for (auto& node : graphNodes) {
+            const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+            if (!selectedPd || !isRefinable(node) || node->isDynamicNode())
+                continue;
+
+            const int selectedIdx = node->selectedPrimitiveDescriptorIndex;
+            size_t selectedCost = 0;
+            if (!nodeCost(node, selectedPd, selectedCost))
+                continue;
+
+            int bestIdx = selectedIdx;
+            size_t bestCost = selectedCost;
+            const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+            for (size_t i = 0; i < supportedPds.size(); i++) {
+                if (static_cast<int>(i) == selectedIdx ||
+                    supportedPds[i].getImplementationType() != selectedPd->getImplementationType())
+                    continue;
+                size_t cost = 0;
+                if (nodeCost(node, &supportedPds[i], cost) && cost < bestCost) {
+                    bestCost = cost;
+                    bestIdx = static_cast<int>(i);
+                }
+            }
+
+            if (bestIdx != selectedIdx) {
+                DEBUG_LOG("RefineMemoryFormats: ", node->getName(), " pd[", selectedIdx, "] -> pd[", bestIdx,
+                          "], estimated memory traffic ", selectedCost, " -> ", bestCost, " bytes");
+                node->selectPrimitiveDescriptorByIndex(bestIdx);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+}
+
 void Graph::ResolveInplaceDirections() {
      OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::ResolveInplaceDirections");
 
@@ -481,10 +614,50 @@ void Graph::ExtractExecutableNodes() {
     }
 }
 
+void Graph::InitWeightsPrefetching() {
+    weightsPrefetchPoints.clear();
+    weightsPrefetcher = context->getWeightsPrefetcher();
+    if (!weightsPrefetcher)
+        return;
+    // the weights of the dynamic nodes may be repacked on the shapes change
+    if (std::any_of(executableGraphNodes.begin(), executableGraphNodes.end(), [](const NodePtr& node) {
+            return node->isDynamicNode();
+        }))
+        return;
+
+    // the weights fitting into the cache of the core are loaded by the node itself fast enough
+    const size_t minWeightsSize = dnnl::utils::get_cache_size(2, true);
+    size_t prevHeavyNode = 0;
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        const auto weights = executableGraphNodes[i]->getWeightsMemory();
+        if (!weights || weights->getSize() < minWeightsSize)
+            continue;
+        // the weights of the first heavy node are loaded during the execution of the nodes preceding it
+        if (i != prevHeavyNode)
+            weightsPrefetchPoints.emplace_back(prevHeavyNode, i);
+        prevHeavyNode = i;
+    }
+}
+
+/* The nodes which primitive creation is dominated by building of the own oneDNN primitives or JIT kernels, and touches
+ * only the shared state guarded for concurrent access (the weights cache, the primitive cache and the scratchpad).
+ */
+static bool canCreatePrimitiveConcurrently(const NodePtr& node) {
+    return one_of(node->getType(), Type::Convolution, Type::Deconvolution, Type::FullyConnected, Type::MatMul,
+                  Type::Pooling, Type::Eltwise, Type::Subgraph, Type::MVN, Type::Interpolate, Type::Reduce,
+                  Type::Softmax, Type::Transpose, Type::Reorder);
+}
+
 void Graph::CreatePrimitivesAndExecConstants() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     dnnl::stream stream(getEngine());
 
+    // The constant nodes are created and executed in the topological order, since the primitive creation of their
+    // consumers may need the constant data (e.g. to repack the weights). The primitives of the non constant nodes
+    // don't depend on each other, so the expensive ones are created in parallel after the constants are ready.
+    std::vector<NodePtr> concurrentNodes;
+    const bool createConcurrently = parallel_get_max_threads() > 1;
+
     using shared_memory_ptr = WeightsSharing::SharedMemory::Ptr;
 
     auto acquireSharedOutputs = [this](const NodePtr & node) {
@@ -510,6 +683,11 @@ void Graph::CreatePrimitivesAndExecConstants() const {
     };
 
     for (const auto &node : graphNodes) {
+        if (createConcurrently && !node->isConstant() && canCreatePrimitiveConcurrently(node)) {
+            concurrentNodes.push_back(node);
+            continue;
+        }
+
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
@@ -533,6 +711,23 @@ void Graph::CreatePrimitivesAndExecConstants() const {
             ExecuteNode(node, stream);
         }
     }
+
+    // the exceptions can't leave the parallel region, so the first one in the topological order is rethrown after it
+    std::vector<std::exception_ptr> exceptions(concurrentNodes.size());
+    parallel_for(concurrentNodes.size(), [&](size_t i) {
+        const auto& node = concurrentNodes[i];
+        try {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+            DEBUG_LOG(*node);
+            node->createPrimitive();
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    });
+    for (const auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
 }
 
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
@@ -599,6 +794,12 @@ void Graph::InitEdges() {
         auto reorderStatus = graphEdges[i]->needReorder();
         DEBUG_LOG(graphEdges[i]->name(), " reorderStatus = ", reorderStatus);
         if (reorderStatus == Edge::ReorderStatus::Regular) {
+            // report the conversions left, e.g. the nodes which don't support the inference precision
+            if (edge->getInputDesc().getPrecision() != edge->getOutputDesc().getPrecision()) {
+                DEBUG_LOG("Precision conversion ", edge->getInputDesc().getPrecision(), " -> ", edge->getOutputDesc().getPrecision(),
+                          " between ", edge->getParent()->getTypeStr(), " node ", edge->getParent()->getName(),
+                          " and ", edge->getChild()->getTypeStr(), " node ", edge->getChild()->getName());
+            }
             Edge::ReorderStatus reorderStatusInternal = Edge::ReorderStatus::Regular;
             // Check if there is a reorder that needs the precision conversion
             if (edge->getInputDesc().getPrecision() != edge->getOutputDesc().getPrecision() &&
@@ -974,6 +1175,9 @@ bool Graph::ProcessDynNodes() {
     bool result = false;
     for (size_t i = 0; i < graphNodes.size(); ++i) {
         const auto& node = graphNodes[i];
+        if (one_of(node->getType(), Type::If, Type::TensorIterator)) {
+            hasInnerGraphs = true;
+        }
         if (node->isDynamicNode()) {
             result = true;
             if (node->outputShapeDataDependency() ||
@@ -1122,28 +1326,37 @@ void Graph::PullOutputData(BlobMap &out) {
 void Graph::InferStatic(InferRequestBase* request) {
     dnnl::stream stream(getEngine());
 
-    for (const auto& node : executableGraphNodes) {
+    auto prefetchPoint = weightsPrefetchPoints.begin();
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        const auto& node = executableGraphNodes[i];
         VERBOSE(node, getConfig().debugCaps.verbose);
         PERF(node, getConfig().collectPerfCounters);
 
         if (request)
             request->ThrowIfCanceled();
+        if (prefetchPoint != weightsPrefetchPoints.end() && prefetchPoint->first == i) {
+            weightsPrefetcher->Prefetch(executableGraphNodes[prefetchPoint->second]->getWeightsMemory());
+            ++prefetchPoint;
+        }
         ExecuteNode(node, stream);
     }
 }
 
 namespace {
 
+using ExecuteNodeFn = std::function<void(size_t)>;
+
 class IUpdateNodes {
 public:
-    virtual void run(size_t stopIndx) = 0;
+    // Prepares the nodes up to stopIndx and passes them to execute in order
+    virtual void run(size_t stopIndx, const ExecuteNodeFn& execute) = 0;
     virtual ~IUpdateNodes() = default;
 };
 
 class UpdateNodesSeq : public IUpdateNodes {
 public:
     explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
-    void run(size_t stopIndx) override {
+    void run(size_t stopIndx, const ExecuteNodeFn& execute) override {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
@@ -1151,10 +1364,14 @@ public:
                 node->updateDynamicParams();
             }
         }
+        for (; executeCounter < stopIndx; ++executeCounter) {
+            execute(executeCounter);
+        }
     }
 
 private:
     size_t prepareCounter = 0;
+    size_t executeCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
 };
 
@@ -1163,9 +1380,18 @@ private:
 #endif
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_OMP)
+/*
+ * Without pipelining, the shapes of the nodes up to the sync point are updated by the calling task, while the dynamic
+ * params are prepared by the spawned task following it, and the nodes are executed when both tasks are done.
+ * In the pipelined mode, the calling task updates the shapes of all the nodes up to the sync point, so the memory of the
+ * edges is not reallocated anymore, and then prepares the params of the nodes one by one, while the spawned task
+ * executes the nodes which params are already prepared. In both modes only the spawned task waits for the other one:
+ * if no thread takes it, it's run by the calling thread when the calling task is done, so it never waits there.
+ */
 class UpdateNodesBase : public IUpdateNodes {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, bool pipelined)
+        : m_executableGraphNodes(executableGraphNodes), m_pipelined(pipelined) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
@@ -1201,10 +1427,86 @@ public:
         }
     }
 
+    void prepare(size_t node_indx, size_t stop_indx) {
+        try {
+            updateShapes(node_indx, stop_indx);
+            for (size_t i = node_indx; i < stop_indx; i++) {
+                // the execution has failed, the rest of the params won't be used
+                if (m_executionFailed.load(std::memory_order::memory_order_acquire))
+                    return;
+                const auto& node = m_executableGraphNodes[i];
+                if (node->isDynamicNode()) {
+                    node->updateDynamicParams();
+                }
+                m_paramsCounter.store(i + 1, std::memory_order::memory_order_release);
+            }
+        }
+        catch(...) {
+            m_paramsFailed.store(true, std::memory_order::memory_order_release);
+            throw;
+        }
+    }
+
+    void execute(size_t node_indx, size_t stop_indx) {
+        try {
+            for (size_t i = node_indx; i < stop_indx; i++) {
+                while (m_paramsCounter.load(std::memory_order::memory_order_acquire) <= i) {
+                    if (m_paramsFailed.load(std::memory_order::memory_order_acquire))
+                        return;
+                    std::this_thread::yield();
+                }
+                (*m_execute)(i);
+            }
+        }
+        catch(...) {
+            m_executionFailed.store(true, std::memory_order::memory_order_release);
+            throw;
+        }
+    }
+
 protected:
+    void reset(const ExecuteNodeFn& execute) {
+        m_completion.store(false);
+        m_paramsFailed.store(false);
+        m_executionFailed.store(false);
+        m_paramsCounter.store(m_prepareCounter.load());
+        m_execute = &execute;
+    }
+
+    // the calling task
+    void runFirst(size_t node_indx, size_t stop_indx) {
+        if (m_pipelined) {
+            prepare(node_indx, stop_indx);
+        } else {
+            updateShapes(node_indx, stop_indx);
+        }
+    }
+
+    // the spawned task
+    void runSecond(size_t node_indx, size_t stop_indx) {
+        if (m_pipelined) {
+            execute(node_indx, stop_indx);
+        } else {
+            updateDynParams(node_indx, stop_indx);
+        }
+    }
+
+    void executeRest(size_t node_indx, size_t stop_indx) {
+        if (!m_pipelined) {
+            for (size_t i = node_indx; i < stop_indx; i++) {
+                (*m_execute)(i);
+            }
+        }
+    }
+
     std::atomic<size_t> m_prepareCounter{0};
+    std::atomic<size_t> m_paramsCounter{0};
     std::atomic<bool> m_completion{false};
+    std::atomic<bool> m_paramsFailed{false};
+    std::atomic<bool> m_executionFailed{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    const bool m_pipelined;
+    const ExecuteNodeFn* m_execute = nullptr;
 };
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -1215,7 +1517,12 @@ public:
     AsyncTask(Body& body, tbb::detail::d1::wait_context& wait, size_t node_indx, size_t stop_indx) :
         m_body(body), m_wait(wait), m_node_indx(node_indx), m_stop_indx(stop_indx) {}
     task* execute(tbb::detail::d1::execution_data&) override {
-        m_body(m_node_indx, m_stop_indx);
+        // the wait context must be released even if the body throws, otherwise the waiting thread hangs
+        try {
+            m_body(m_node_indx, m_stop_indx);
+        } catch (...) {
+            m_exception = std::current_exception();
+        }
         m_wait.release();
         return nullptr;
     }
@@ -1223,34 +1530,42 @@ public:
         m_wait.release();
         return nullptr;
     }
+    void rethrow() const {
+        if (m_exception)
+            std::rethrow_exception(m_exception);
+    }
 
 private:
     Body& m_body;
     tbb::detail::d1::wait_context& m_wait;
     size_t m_node_indx;
     size_t m_stop_indx;
+    std::exception_ptr m_exception;
 };
 
 class UpdateNodes : public UpdateNodesBase {
 public:
     using UpdateNodesBase::UpdateNodesBase;
-    void run(size_t stopIndx) override {
-        m_completion.store(false);
+    void run(size_t stopIndx, const ExecuteNodeFn& execute) override {
         auto startCounter = m_prepareCounter.load();
+        reset(execute);
         tbb::detail::d1::wait_context wait_ctx(2);
 
         auto task1 = [this](size_t start, size_t stop) {
-            this->updateShapes(start, stop);
+            this->runFirst(start, stop);
         };
         AsyncTask<decltype(task1)> t1(task1, wait_ctx, startCounter, stopIndx);
 
         auto task2 = [this](size_t start, size_t stop) {
-            this->updateDynParams(start, stop);
+            this->runSecond(start, stop);
         };
         AsyncTask<decltype(task2)> t2(task2, wait_ctx, startCounter, stopIndx);
 
         tbb::detail::d1::spawn(t2, ctx, /* always submit the task to a thread that occupies the first slot */ 1);
         tbb::detail::d1::execute_and_wait(t1, ctx, wait_ctx, ctx);
+        t1.rethrow();
+        t2.rethrow();
+        executeRest(startCounter, stopIndx);
     }
 
 private:
@@ -1260,14 +1575,21 @@ private:
 template <typename Body>
 class AsyncTask : public tbb::task {
 public:
-    AsyncTask(Body& body, size_t node_indx, size_t stop_indx) : m_body(body), m_node_indx(node_indx), m_stop_indx(stop_indx) {}
+    AsyncTask(Body& body, std::exception_ptr& exception, size_t node_indx, size_t stop_indx) :
+        m_body(body), m_exception(exception), m_node_indx(node_indx), m_stop_indx(stop_indx) {}
     task* execute() override {
-        m_body(m_node_indx, m_stop_indx);
+        // the exception would cancel the other task, which may be already waiting for this one
+        try {
+            m_body(m_node_indx, m_stop_indx);
+        } catch (...) {
+            m_exception = std::current_exception();
+        }
         return nullptr;
     }
 
 private:
     Body& m_body;
+    std::exception_ptr& m_exception;
     size_t m_node_indx;
     size_t m_stop_indx;
 };
@@ -1275,25 +1597,33 @@ private:
 class UpdateNodes : public UpdateNodesBase {
 public:
     using UpdateNodesBase::UpdateNodesBase;
-    void run(size_t stopIndx) override {
-        m_completion.store(false);
+    void run(size_t stopIndx, const ExecuteNodeFn& execute) override {
         auto startCounter = m_prepareCounter.load();
+        reset(execute);
         tbb::task& root = *new(tbb::task::allocate_root()) tbb::empty_task;
         root.set_ref_count(3); // two for children and one preserved
 
+        std::exception_ptr exception1, exception2;
         auto task1 = [this](size_t start, size_t stop) {
-            this->updateShapes(start, stop);
+            this->runFirst(start, stop);
         };
-        AsyncTask<decltype(task1)>& a = *new (root.allocate_child()) AsyncTask<decltype(task1)>(task1, startCounter, stopIndx);
+        AsyncTask<decltype(task1)>& a =
+            *new (root.allocate_child()) AsyncTask<decltype(task1)>(task1, exception1, startCounter, stopIndx);
 
         auto task2 = [this](size_t start, size_t stop) {
-            this->updateDynParams(start, stop);
+            this->runSecond(start, stop);
         };
-        AsyncTask<decltype(task2)>& b = *new (root.allocate_child()) AsyncTask<decltype(task2)>(task2, startCounter, stopIndx);
+        AsyncTask<decltype(task2)>& b =
+            *new (root.allocate_child()) AsyncTask<decltype(task2)>(task2, exception2, startCounter, stopIndx);
 
         b.set_affinity(2); // slot 1 plus 1
         tbb::task::spawn(b);
         root.spawn_and_wait_for_all(a);
+        if (exception1)
+            std::rethrow_exception(exception1);
+        if (exception2)
+            std::rethrow_exception(exception2);
+        executeRest(startCounter, stopIndx);
     }
 };
 #endif
@@ -1303,9 +1633,9 @@ public:
 class UpdateNodes : public UpdateNodesBase {
 public:
     using UpdateNodesBase::UpdateNodesBase;
-    void run(size_t stopIndx) override {
-        m_completion.store(false);
+    void run(size_t stopIndx, const ExecuteNodeFn& execute) override {
         auto startCounter = m_prepareCounter.load();
+        reset(execute);
 
         #pragma omp parallel
         #pragma omp single
@@ -1320,6 +1650,7 @@ public:
             }
             #pragma omp taskwait
         }
+        executeRest(startCounter, stopIndx);
     }
 };
 #endif
@@ -1340,25 +1671,37 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    // The inner graphs share the scratchpad with this graph and guard it on their own, and the nested parallel regions of
+    // the nodes executed inside the OMP task would be serialized, so these nodes are executed after the preparation
+    const bool parallelUpdate = parallel_get_max_threads() > 1;
+#if (OV_THREAD == OV_THREAD_OMP)
+    const bool pipelined = false;
+#else
+    const bool pipelined = parallelUpdate && !hasInnerGraphs;
+#endif
+
     std::unique_ptr<IUpdateNodes> updateNodes{};
-    if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
+    if (parallelUpdate) {
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, pipelined));
     } else {
         updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
     }
-    size_t inferCounter = 0;
+
+    const auto scratchPad = context->getScratchPad();
+    const ExecuteNodeFn execute = [&](size_t nodeIndx) {
+        auto& node = executableGraphNodes[nodeIndx];
+        VERBOSE(node, getConfig().debugCaps.verbose);
+        PERF(node, getConfig().collectPerfCounters);
+
+        if (request)
+            request->ThrowIfCanceled();
+        // the following nodes may be prepared concurrently, so the scratchpad can't be reallocated under the node
+        DnnlScratchPad::ExecutionGuard guard(*scratchPad, pipelined);
+        ExecuteNode(node, stream);
+    };
 
     for (auto stopIndx : syncIndsWorkSet) {
-        updateNodes->run(stopIndx);
-        for (; inferCounter < stopIndx; ++inferCounter) {
-            auto& node = executableGraphNodes[inferCounter];
-            VERBOSE(node, getConfig().debugCaps.verbose);
-            PERF(node, getConfig().collectPerfCounters);
-
-            if (request)
-                request->ThrowIfCanceled();
-            ExecuteNode(node, stream);
-        }
+        updateNodes->run(stopIndx, execute);
     }
 }
 
@@ -1379,6 +1722,9 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    if (preparationPending)
+        FinalizePreparation();
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
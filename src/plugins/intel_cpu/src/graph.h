@@ -13,6 +13,7 @@
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "weights_prefetcher.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -186,6 +187,13 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    /**
+     * @brief Defers the creation of the node primitives and the execution of the constant paths to the first Infer call.
+     * The weights of the graph are reordered and packed (and the pages of the mapped weights file are read) only if the
+     * graph is ever executed, e.g. for the rarely taken branch of the If operation. Must be set before CreateGraph.
+     */
+    void SetLazyPreparation(bool lazy) { lazyPreparation = lazy; }
+
     void SortTopologically();
 
     bool hasDynamicInput() const {
@@ -206,6 +214,10 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        hasInnerGraphs = false;
+        preparationPending = false;
+        weightsPrefetchPoints.clear();
+        weightsPrefetcher.reset();
     }
     Status status { Status::NotReady };
 
@@ -215,6 +227,9 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    bool lazyPreparation = false;
+    bool preparationPending = false;
+
     MemoryPtr memWorkspace;
 
     std::vector<NodePtr> graphNodes;
@@ -230,6 +245,7 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void RefineMemoryFormats();
     void ResolveInplaceDirections();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
@@ -237,8 +253,10 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
+    void InitWeightsPrefetching();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
+    void FinalizePreparation();
     void InferStatic(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
@@ -260,9 +278,14 @@ private:
     std::vector<NodePtr> executableGraphNodes;
 
     std::unordered_map<Node*, size_t> syncNodesInds;
+    bool hasInnerGraphs = false;
 
     GraphContext::CPtr context;
 
+    // (index of the executable node, index of the node the weights of which are prefetched while it is executed)
+    std::vector<std::pair<size_t, size_t>> weightsPrefetchPoints;
+    WeightsPrefetcher::Ptr weightsPrefetcher;  // the prefetcher of the compiled model, see GraphContext
+
     void EnforceInferencePrecision();
     void EnforceBF16();
     void resolveInPlaceDirection(const NodePtr& node) const;
@@ -9,6 +9,7 @@
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
+#include "weights_prefetcher.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -21,10 +22,12 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 WeightsPrefetcher::Ptr weightsPrefetcher = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          weightsPrefetcher(weightsPrefetcher),
           isGraphQuantizedFlag(isGraphQuantized) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
@@ -42,6 +45,10 @@ public:
         return weightsCache;
     }
 
+    WeightsPrefetcher::Ptr getWeightsPrefetcher() const {
+        return weightsPrefetcher;
+    }
+
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
@@ -64,6 +71,7 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsPrefetcher::Ptr weightsPrefetcher; // shared by the graphs of all the streams, if the prefetch is enabled
 
     MultiCachePtr rtParamsCache;     // primitive cache
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
@@ -139,6 +139,11 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
         return inputs;
     };
 
+    // the node the weights of which are prefetched -> the node during the execution of which they are prefetched
+    std::map<NodePtr, NodePtr> prefetched_weights;
+    for (const auto& point : graph.weightsPrefetchPoints)
+        prefetched_weights[graph.executableGraphNodes[point.second]] = graph.executableGraphNodes[point.first];
+
     auto create_ngraph_node = [&](const NodePtr &node) {
         bool is_input = false, is_output = false, should_be_hold = false;
         for (auto && kvp : graph.inputNodesMap) {
@@ -162,6 +167,9 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
         }
 
         auto meta_data = extract_node_metadata(node);
+        auto prefetched = prefetched_weights.find(node);
+        if (prefetched != prefetched_weights.end())
+            meta_data["weightsPrefetchedDuring"] = prefetched->second->getName();
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto& desc = node->getChildEdgeAt(0)->getMemory().getDesc();
@@ -333,7 +341,11 @@ void summary_perf(const Graph &graph) {
                << std::setw(8) << std::right  << node->PerfCounter().avg() << "(us)x" << node->PerfCounter().count()
                << " #" << node->getExecIndex()
                << " " << node->getName()
-               << " " << node->getTypeStr() + "_" + node->getPrimitiveDescriptorType() << std::endl;
+               << " " << node->getTypeStr() + "_" + node->getPrimitiveDescriptorType();
+            // the bandwidth the weights are read with, to compare the memory bound nodes with the memory roofline
+            if (auto weights = node->getWeightsMemory())
+                ss << " weights:" << static_cast<double>(weights->getSize()) / node->PerfCounter().avg() / 1000 << "(GB/s)";
+            ss << std::endl;
             std::cout << ss.str();
         }
     }
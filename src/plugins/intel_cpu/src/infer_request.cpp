@@ -7,6 +7,8 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <sstream>
+#include <cstring>
 #include <blob_factory.hpp>
 #include "nodes/concat.h"
 #include "nodes/split.h"
@@ -19,6 +21,7 @@
 #include "nodes/memory.hpp"
 #include "nodes/common/cpu_memcpy.h"
 #include "async_infer_request.h"
+#include "requests_coalescer.h"
 #include <debug.h>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
@@ -32,6 +35,26 @@
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+
+// Switches the request to the other graph and restores the graph of the request on the scope exit
+class GraphSwitch {
+public:
+    GraphSwitch(Graph*& graph, Graph* other) : _graph(graph), _original(graph) {
+        _graph = other;
+    }
+
+    ~GraphSwitch() {
+        _graph = _original;
+    }
+
+private:
+    Graph*& _graph;
+    Graph* _original;
+};
+
+}   // namespace
+
 void InferRequestBase::CreateInferRequest() {
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("INTEL_CPU_INFER_" + execNetwork->_name + "_" + std::to_string(id));
@@ -59,12 +82,14 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name, state_store, execNetwork->_stateBlockPool));
         }
     }
 }
 
 InferRequestBase::~InferRequestBase() {
+    if (auto coalescer = GetRequestsCoalescer())
+        coalescer->Remove(this);
     --(execNetwork->_numRequests);
 }
 
@@ -105,12 +130,11 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast the state " << cur_id << " to VariableState";
+                    }
+                    cur_state->CopyTo(cur_node->getStore());
                 }
             }
         }
@@ -127,12 +151,11 @@ void InferRequestBase::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast the state " << cur_id << " to VariableState";
+                    }
+                    cur_state->CopyFrom(cur_node->getStore());
                 }
             }
         }
@@ -161,6 +184,14 @@ void InferRequestBase::InferImpl() {
     ThrowIfCanceled();
     convertBatchedInputBlobs();
 
+    // the inputs matching one of the shape buckets are inferred by the graph compiled for that static shape
+    // (the switch is declared after the lock, so the graph is restored before the bucket graph is unlocked)
+    auto bucketGraphLock = execNetwork->GetBucketGraph(_inputs);
+    std::unique_ptr<GraphSwitch> bucketGraphSwitch;
+    if (bucketGraphLock) {
+        bucketGraphSwitch.reset(new GraphSwitch(graph, &bucketGraphLock->_graph));
+    }
+
     if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
     }
@@ -177,6 +208,7 @@ void InferRequestBase::InferImpl() {
         PushStates();
     }
 
+    inferredGraph = graph;
     graph->Infer(this);
 
     if (memoryStates.size() != 0) {
@@ -196,10 +228,12 @@ void InferRequestBase::InferImpl() {
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
-    if (!graph || !graph->IsReady())
+    // the counters of the graph the last inference was executed by (e.g. the graph of the shape bucket)
+    const auto perfGraph = inferredGraph ? inferredGraph : graph;
+    if (!perfGraph || !perfGraph->IsReady())
         IE_THROW() << "Graph is not ready!";
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
-    graph->GetPerfData(perfMap);
+    perfGraph->GetPerfData(perfMap);
     return perfMap;
 }
 
@@ -360,6 +394,109 @@ void InferRequestBase::ThrowIfCanceled() const {
     }
 }
 
+bool InferRequestBase::IsCanceled() const {
+    try {
+        ThrowIfCanceled();
+    } catch (const InferenceEngine::InferCancelled&) {
+        return true;
+    }
+    return false;
+}
+
+std::shared_ptr<RequestsCoalescer> InferRequestBase::GetRequestsCoalescer() const {
+    return execNetwork->_requestsCoalescer;
+}
+
+std::string InferRequestBase::GetCoalescingKey() const {
+    if (!_preProcData.empty() || !_batched_inputs.empty() || !memoryStates.empty())
+        return {};
+
+    // the rows of the batched blobs are copied from/to the request blobs as is, so the blobs must be dense and
+    // have the batch as the outermost dimension
+    auto isBatchRow = [](const InferenceEngine::Blob::Ptr& blob) {
+        const auto& desc = blob->getTensorDesc();
+        const auto& dims = desc.getDims();
+        return blob->as<InferenceEngine::MemoryBlob>() && !dims.empty() && dims[0] == 1 &&
+               !one_of(desc.getLayout(), InferenceEngine::Layout::ANY, InferenceEngine::Layout::BLOCKED) &&
+               desc == InferenceEngine::TensorDesc(desc.getPrecision(), dims, desc.getLayout()) &&
+               desc.getBlockingDesc().getOrder()[0] == 0;
+    };
+
+    std::ostringstream key;
+    for (const auto& input : _inputs) {
+        if (!isBatchRow(input.second) || graph->hasMeanImageFor(input.first) ||
+            normToInputSupportedPrec(input) != input.second->getTensorDesc().getPrecision())
+            return {};
+        key << input.first << ':' << input.second->getTensorDesc().getPrecision() << ':'
+            << input.second->getTensorDesc().getLayout() << ';';
+    }
+    for (const auto& output : _outputs) {
+        if (!isBatchRow(output.second))
+            return {};
+        key << output.first << ':' << output.second->getTensorDesc().getPrecision() << ':'
+            << output.second->getTensorDesc().getLayout() << ';';
+    }
+    return key.str();
+}
+
+void InferRequestBase::InferCoalesced(Graph& graph, const std::vector<InferRequestBase*>& requests) {
+    const auto& first = *requests.front();
+    const auto& inputNodesMap = graph.GetInputNodesMap();
+    auto makeBatchedBlob = [](const InferenceEngine::Blob::Ptr& row, size_t batch) {
+        auto desc = row->getTensorDesc();
+        auto dims = desc.getDims();
+        dims[0] = batch;
+        auto blob = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims, desc.getLayout()));
+        blob->allocate();
+        return blob;
+    };
+
+    for (const auto& input : first._inputs) {
+        const auto& name = input.first;
+        auto inputNode = inputNodesMap.find(name);
+        OPENVINO_ASSERT(inputNode != inputNodesMap.end(), "Cannot find input blob: ", name, " in the coalesced graph");
+        const auto graphBatch = inputNode->second->getOutputShapeAtPort(0).getStaticDims()[0];
+        OPENVINO_ASSERT(graphBatch >= requests.size(), "The coalesced graph batch is less than the requests number");
+
+        auto batched = makeBatchedBlob(input.second, graphBatch);
+        const auto rowSize = input.second->byteSize();
+        auto dst = batched->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < requests.size(); i++) {
+            const auto& rowBlob = requests[i]->_inputs.at(name);
+            cpu_memcpy(dst + i * rowSize, rowBlob->cbuffer().as<const uint8_t*>(), rowSize);
+        }
+        // the rows of the absent requests are never read back, zeros just keep them free of denormals and NaNs
+        std::memset(dst + requests.size() * rowSize, 0, (graphBatch - requests.size()) * rowSize);
+
+        graph.PushInputData(name, batched);
+    }
+
+    graph.Infer();
+
+    InferenceEngine::BlobMap batchedOutputs;
+    const auto& outputNodesMap = graph.GetOutputNodesMap();
+    for (const auto& output : first._outputs) {
+        auto outputNode = outputNodesMap.find(output.first);
+        OPENVINO_ASSERT(outputNode != outputNodesMap.end(), "Cannot find output blob: ", output.first, " in the coalesced graph");
+        const auto graphBatch = outputNode->second->getInputShapeAtPort(0).getStaticDims()[0];
+        batchedOutputs[output.first] = makeBatchedBlob(output.second, graphBatch);
+    }
+
+    graph.PullOutputData(batchedOutputs);
+
+    for (const auto& output : batchedOutputs) {
+        const auto rowSize = first._outputs.at(output.first)->byteSize();
+        auto src = output.second->cbuffer().as<const uint8_t*>();
+        for (size_t i = 0; i < requests.size(); i++) {
+            const auto& rowBlob = requests[i]->_outputs.at(output.first);
+            cpu_memcpy(rowBlob->buffer().as<uint8_t*>(), src + i * rowSize, rowSize);
+        }
+    }
+    // each request of the batch reports the counters of the coalesced graph
+    for (auto request : requests)
+        request->inferredGraph = &graph;
+}
+
 InferenceEngine::Precision
 InferRequestBase::normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const {
     const auto& inputTensorDesc = input.second->getTensorDesc();
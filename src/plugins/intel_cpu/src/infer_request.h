@@ -16,6 +16,7 @@ namespace intel_cpu {
 
 class ExecNetwork;
 class AsyncInferRequest;
+class RequestsCoalescer;
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
@@ -38,6 +39,30 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Returns true if `_asyncRequest` is initialized and the inference request is canceled
+     */
+    bool IsCanceled() const;
+
+    /**
+     * @brief Returns the coalescer of the asynchronous requests of the executable network or nullptr if the requests
+     * coalescing is disabled (see ov::intel_cpu::max_coalesced_requests)
+     */
+    std::shared_ptr<RequestsCoalescer> GetRequestsCoalescer() const;
+
+    /**
+     * @brief Returns the key describing the user blobs of the request. The requests with the same non-empty key can be
+     * inferred together by the coalesced graph, the request with the empty key can be inferred only alone
+     */
+    std::string GetCoalescingKey() const;
+
+    /**
+     * @brief Infers the requests by one inference of the graph compiled with the batch not less than the requests number
+     * @param graph The coalesced graph
+     * @param requests The requests with the same coalescing key
+     */
+    static void InferCoalesced(Graph& graph, const std::vector<InferRequestBase*>& requests);
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -109,6 +134,8 @@ protected:
     virtual void PushInputData() = 0;
 
     Graph* graph = nullptr;
+    // the graph the last inference was executed by, it differs from the graph of the request for the shape buckets
+    Graph* inferredGraph = nullptr;
     std::unordered_map<std::string, InferenceEngine::Blob::Ptr> externalPtr;
 
     std::unordered_map<std::string, OutputControlBlock> outputControlBlocks;
@@ -5,16 +5,206 @@
 #include "memory_state.h"
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
+#include "ie_parallel.hpp"
+
+#include <cstring>
+#include <new>
+#include <unordered_map>
 
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+
+bool isZero(const uint8_t* data, size_t size) {
+    return data[0] == 0 && std::memcmp(data, data + 1, size - 1) == 0;
+}
+
+// The storages the values returned by VariableState::GetState were read from, by the buffers of the values
+struct StateValues {
+    std::mutex mutex;
+    std::unordered_map<const void*, PagedStateStorage> storages;
+
+    static StateValues& get() {
+        static StateValues values;
+        return values;
+    }
+};
+
+// Allocates the buffer of the state value and keeps the storage the value was read from while the value is alive
+class StateValueAllocator : public IAllocator {
+public:
+    explicit StateValueAllocator(PagedStateStorage storage) : _storage(std::move(storage)) {}
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        auto buffer = new (std::nothrow) uint8_t[size];
+        if (buffer) {
+            auto& values = StateValues::get();
+            try {
+                std::lock_guard<std::mutex> lock(values.mutex);
+                values.storages.emplace(buffer, _storage);
+            } catch (...) {
+                delete[] buffer;
+                return nullptr;
+            }
+        }
+        return buffer;
+    }
+
+    bool free(void* handle) noexcept override {
+        auto& values = StateValues::get();
+        {
+            std::lock_guard<std::mutex> lock(values.mutex);
+            values.storages.erase(handle);
+        }
+        delete[] static_cast<uint8_t*>(handle);
+        return true;
+    }
+
+private:
+    PagedStateStorage _storage;
+};
+
+}   // namespace
+
+constexpr size_t StateBlockPool::blockSize;
+
+StateBlockPool::Block StateBlockPool::Allocate() {
+    uint8_t* data = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _usedBlocks++;
+        if (!_freeBlocks.empty()) {
+            data = _freeBlocks.back().release();
+            _freeBlocks.pop_back();
+        }
+    }
+    if (!data) {
+        try {
+            data = new uint8_t[blockSize];
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _usedBlocks--;
+            throw;
+        }
+    }
+    auto pool = shared_from_this();
+    return Block(data, [pool](uint8_t* data) {
+        pool->Release(data);
+    });
+}
+
+void StateBlockPool::Release(uint8_t* data) {
+    std::unique_ptr<uint8_t[]> block(data);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _usedBlocks--;
+    _freeBlocks.push_back(std::move(block));
+}
+
+size_t StateBlockPool::GetUsedBlocks() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _usedBlocks;
+}
+
+size_t StateBlockPool::GetFreeBlocks() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _freeBlocks.size();
+}
+
+PagedStateStorage::PagedStateStorage(StateBlockPool::Ptr pool, size_t size)
+    : _pool(std::move(pool)), _size(size), _blocks((size + StateBlockPool::blockSize - 1) / StateBlockPool::blockSize) {}
+
+void PagedStateStorage::Read(void* dst) const {
+    auto dstData = static_cast<uint8_t*>(dst);
+    parallel_for(_blocks.size(), [&](size_t i) {
+        const auto offset = i * StateBlockPool::blockSize;
+        const auto size = std::min(StateBlockPool::blockSize, _size - offset);
+        if (_blocks[i])
+            std::memcpy(dstData + offset, _blocks[i].get(), size);
+        else
+            std::memset(dstData + offset, 0, size);
+    });
+}
+
+void PagedStateStorage::Write(const void* src) {
+    auto srcData = static_cast<const uint8_t*>(src);
+    parallel_for(_blocks.size(), [&](size_t i) {
+        const auto offset = i * StateBlockPool::blockSize;
+        const auto size = std::min(StateBlockPool::blockSize, _size - offset);
+        auto& block = _blocks[i];
+        // the unchanged shared block stays shared and the zero block isn't allocated, the block owned alone is
+        // overwritten without the comparison, which would cost as much as the copy it could skip
+        if (!block) {
+            if (isZero(srcData + offset, size))
+                return;
+            block = _pool->Allocate();
+        } else if (block.use_count() > 1) {
+            if (std::memcmp(block.get(), srcData + offset, size) == 0)
+                return;
+            block = _pool->Allocate();
+        }
+        std::memcpy(block.get(), srcData + offset, size);
+    });
+}
+
+void PagedStateStorage::Reset() {
+    for (auto& block : _blocks)
+        block.reset();
+}
+
+VariableState::VariableState(std::string name, MemoryPtr storage, StateBlockPool::Ptr pool)
+    : IVariableStateInternal{name},
+      _desc(MemoryDescUtils::convertToTensorDesc(storage->getDesc())),
+      _storage(std::move(pool), storage->getSize()) {
+    _storage.Write(storage->getData());
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    _storage.Reset();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState || newState->byteSize() != _storage.size()) {
+        IE_THROW() << "Variable state " << name << " expects the value of " << _storage.size() << " bytes";
+    }
+    const void* data = newState->cbuffer().as<const void*>();
+    if (data == nullptr) {
+        IE_THROW() << "Variable state " << name << " got the value with no allocated memory";
+    }
+
+    auto& values = StateValues::get();
+    {
+        std::lock_guard<std::mutex> lock(values.mutex);
+        auto value = values.storages.find(data);
+        if (value != values.storages.end() && value->second.size() == _storage.size())
+            _storage = value->second;
+    }
+    // the value may be modified after GetState, so the blocks it differs in are copied
+    _storage.Write(data);
+}
+
+Blob::CPtr VariableState::GetState() const {
+    auto value = make_blob_with_precision(_desc, std::make_shared<StateValueAllocator>(_storage));
+    value->allocate();
+    _storage.Read(value->buffer().as<void*>());
+    return value;
+}
+
+void VariableState::CopyTo(const MemoryPtr& memory) const {
+    _storage.Read(memory->getData());
+}
+
+void VariableState::CopyFrom(const MemoryPtr& memory) {
+    _storage.Write(memory->getData());
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
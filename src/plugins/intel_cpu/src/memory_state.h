@@ -10,21 +10,87 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
-class VariableState : public InferenceEngine::IVariableStateInternal {
+/**
+ * @brief Pool of the fixed-size blocks the variable states are stored in. The blocks released by the states are kept
+ * in the pool and reused, so the states of the infer requests don't allocate memory on each update.
+ */
+class StateBlockPool : public std::enable_shared_from_this<StateBlockPool> {
+public:
+    using Ptr = std::shared_ptr<StateBlockPool>;
+    // the block keeps the pool alive and returns to it when the last owner releases the block
+    using Block = std::shared_ptr<uint8_t>;
+
+    static constexpr size_t blockSize = 64 * 1024;
+
+    Block Allocate();
+
+    // The number of the blocks owned by the states and their values
+    size_t GetUsedBlocks();
+    // The number of the released blocks kept for reuse
+    size_t GetFreeBlocks();
+
+private:
+    void Release(uint8_t* data);
+
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<uint8_t[]>> _freeBlocks;
+    size_t _usedBlocks = 0;
+};
+
+/**
+ * @brief The value of the variable state stored in the table of the pool blocks. The copied storage shares the blocks
+ * with the original one: the shared block is copied on write only if its contents change, so the unchanged blocks
+ * (e.g. the prefix of the sequence continued by several requests) are stored once. The missing block is read as zeros.
+ * The block owned by the storage alone is overwritten without the comparison, so the write of the unshared storage
+ * costs the same copy as the contiguous storage; only the shared and the missing blocks are compared.
+ */
+class PagedStateStorage {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->getData(), storage->getSize());
+    PagedStateStorage(StateBlockPool::Ptr pool, size_t size);
+
+    size_t size() const {
+        return _size;
     }
 
+    void Read(void* dst) const;
+    void Write(const void* src);
+    void Reset();
+
+private:
+    StateBlockPool::Ptr _pool;
+    size_t _size;
+    std::vector<StateBlockPool::Block> _blocks;
+};
+
+class VariableState : public InferenceEngine::IVariableStateInternal {
+public:
+    VariableState(std::string name, MemoryPtr storage, StateBlockPool::Ptr pool);
+
     void Reset() override;
+
+    /**
+     * @brief The value returned by GetState of the other state is not copied: the storage of this state shares
+     * the blocks of the value, and only the blocks modified after GetState are copied.
+     */
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    // Exchange the value with the memory of the MemoryInput node, which holds the state during the inference
+    void CopyTo(const MemoryPtr& memory) const;
+    void CopyFrom(const MemoryPtr& memory);
+
+private:
+    InferenceEngine::TensorDesc _desc;
+    PagedStateStorage _storage;
 };
 
 }   // namespace intel_cpu
@@ -429,6 +429,14 @@ public:
      */
     virtual InferenceEngine::Precision getRuntimePrecision() const;
 
+    /**
+     * @brief Returns the constant weights the node reads on each execution
+     * @return Memory of the weights in the layout used by the executor or nullptr if the node has no such weights
+     */
+    virtual MemoryCPtr getWeightsMemory() const {
+        return nullptr;
+    }
+
     const std::vector<InferenceEngine::Precision>& getOriginalInputPrecisions() const {
         return originalInputPrecisions;
     }
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "box_iou.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+static inline float box_iou_ref(const float* box, const float box_area,
+                                const float x0, const float y0, const float x1, const float y1, const float area,
+                                const float offset, const iou_mode mode) {
+    float width = (std::min)(box[2], x1) - (std::max)(box[0], x0) + offset;
+    float height = (std::min)(box[3], y1) - (std::max)(box[1], y0) + offset;
+    if (mode == iou_mode::multiclass_nms) {
+        if (box_area <= 0.f || area <= 0.f)
+            return 0.f;
+        width = (std::max)(width, 0.f);
+        height = (std::max)(height, 0.f);
+    } else {
+        if (x0 > box[2] || x1 < box[0] || y0 > box[3] || y1 < box[1])
+            return 0.f;
+        if (mode == iou_mode::detection_output && (width <= 0.f || height <= 0.f))
+            return 0.f;
+    }
+    const float intersection = width * height;
+    return intersection / (box_area + area - intersection);
+}
+
+void box_iou(const float* box, const float box_area,
+             const float* x0, const float* y0, const float* x1, const float* y1, const float* areas,
+             const size_t num, const float offset, const iou_mode mode, float* iou) {
+    size_t i = 0;
+
+#if defined(HAVE_AVX2)
+    const __m256 vbox_x0 = _mm256_set1_ps(box[0]);
+    const __m256 vbox_y0 = _mm256_set1_ps(box[1]);
+    const __m256 vbox_x1 = _mm256_set1_ps(box[2]);
+    const __m256 vbox_y1 = _mm256_set1_ps(box[3]);
+    const __m256 vbox_area = _mm256_set1_ps(box_area);
+    const __m256 voffset = _mm256_set1_ps(offset);
+    const __m256 vzero = _mm256_setzero_ps();
+
+    for (; i + 8 <= num; i += 8) {
+        const __m256 vx0 = _mm256_loadu_ps(x0 + i);
+        const __m256 vy0 = _mm256_loadu_ps(y0 + i);
+        const __m256 vx1 = _mm256_loadu_ps(x1 + i);
+        const __m256 vy1 = _mm256_loadu_ps(y1 + i);
+        const __m256 varea = _mm256_loadu_ps(areas + i);
+
+        __m256 vwidth = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vbox_x1, vx1), _mm256_max_ps(vbox_x0, vx0)), voffset);
+        __m256 vheight = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vbox_y1, vy1), _mm256_max_ps(vbox_y0, vy0)), voffset);
+
+        // the masks are built from the negated comparisons of the reference to match it for NaN inputs as well
+        __m256 vvalid;
+        if (mode == iou_mode::multiclass_nms) {
+            vvalid = _mm256_and_ps(_mm256_cmp_ps(vbox_area, vzero, _CMP_NLE_UQ), _mm256_cmp_ps(varea, vzero, _CMP_NLE_UQ));
+            vwidth = _mm256_max_ps(vwidth, vzero);
+            vheight = _mm256_max_ps(vheight, vzero);
+        } else {
+            vvalid = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(vx0, vbox_x1, _CMP_NGT_UQ),
+                                                 _mm256_cmp_ps(vx1, vbox_x0, _CMP_NLT_UQ)),
+                                   _mm256_and_ps(_mm256_cmp_ps(vy0, vbox_y1, _CMP_NGT_UQ),
+                                                 _mm256_cmp_ps(vy1, vbox_y0, _CMP_NLT_UQ)));
+            if (mode == iou_mode::detection_output) {
+                vvalid = _mm256_and_ps(vvalid, _mm256_and_ps(_mm256_cmp_ps(vwidth, vzero, _CMP_NLE_UQ),
+                                                             _mm256_cmp_ps(vheight, vzero, _CMP_NLE_UQ)));
+            }
+        }
+
+        const __m256 vintersection = _mm256_mul_ps(vwidth, vheight);
+        const __m256 vunion = _mm256_sub_ps(_mm256_add_ps(vbox_area, varea), vintersection);
+        _mm256_storeu_ps(iou + i, _mm256_and_ps(_mm256_div_ps(vintersection, vunion), vvalid));
+    }
+#endif
+
+    for (; i < num; i++) {
+        iou[i] = box_iou_ref(box, box_area, x0[i], y0[i], x1[i], y1[i], areas[i], offset, mode);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace intel_cpu {
+
+// The detection post-processing nodes follow different references, which disagree in the handling of
+// the disjoint and degenerate boxes, so each node selects its own rule to keep the results bit-exact.
+enum class iou_mode {
+    // disjoint boxes and empty intersections give 0 (DetectionOutput, ExperimentalDetectronDetectionOutput)
+    detection_output,
+    // disjoint boxes give 0, the intersection is not clipped (MatrixNms)
+    matrix_nms,
+    // the intersection is clipped to 0, boxes with non positive area give 0 (MulticlassNms)
+    multiclass_nms,
+};
+
+namespace XARCH {
+
+// Computes IoU of the box {x0, y0, x1, y1} with each of the num boxes stored in the structure of arrays layout.
+// The offset is added to the width and height of the intersection (1 for not normalized coordinates).
+void box_iou(const float* box, const float box_area,
+             const float* x0, const float* y0, const float* x1, const float* y1, const float* areas,
+             const size_t num, const float offset, const iou_mode mode, float* iou);
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "box_iou.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Boxes in the structure of arrays layout, which the vectorized IoU computation works with.
+ * The NMS-like nodes keep the selected boxes here to check each next candidate against all of them at once.
+ */
+class BoxesSoA {
+public:
+    void reserve(size_t num) {
+        m_x0.reserve(num);
+        m_y0.reserve(num);
+        m_x1.reserve(num);
+        m_y1.reserve(num);
+        m_areas.reserve(num);
+        m_iou.resize(std::max(m_iou.size(), num));
+    }
+
+    void clear() {
+        m_x0.clear();
+        m_y0.clear();
+        m_x1.clear();
+        m_y1.clear();
+        m_areas.clear();
+    }
+
+    size_t size() const {
+        return m_x0.size();
+    }
+
+    // box is {x0, y0, x1, y1}
+    void push_back(const float* box, const float area) {
+        m_x0.push_back(box[0]);
+        m_y0.push_back(box[1]);
+        m_x1.push_back(box[2]);
+        m_y1.push_back(box[3]);
+        m_areas.push_back(area);
+    }
+
+    // IoU of the box with the stored boxes [begin, end), the result is valid until the next call
+    const float* iou(const float* box, const float area, const float offset, const iou_mode mode,
+                     const size_t begin, const size_t end) {
+        if (m_iou.size() < end - begin)
+            m_iou.resize(std::max(end - begin, 2 * m_iou.size()));
+        XARCH::box_iou(box, area, &m_x0[begin], &m_y0[begin], &m_x1[begin], &m_y1[begin], &m_areas[begin],
+                       end - begin, offset, mode, m_iou.data());
+        return m_iou.data();
+    }
+
+    // Checks whether the predicate holds for IoU of the box with any of the stored boxes starting from first. The boxes
+    // are processed by blocks, so the check stops soon after the first match like the scalar loops did.
+    template <typename Predicate>
+    bool any_iou(const float* box, const float area, const float offset, const iou_mode mode, Predicate pred,
+                 const size_t first = 0) {
+        static constexpr size_t block = 64;
+        for (size_t begin = first; begin < size(); begin += block) {
+            const size_t end = std::min(begin + block, size());
+            const float* values = iou(box, area, offset, mode, begin, end);
+            if (std::any_of(values, values + (end - begin), pred))
+                return true;
+        }
+        return false;
+    }
+
+private:
+    std::vector<float> m_x0;
+    std::vector<float> m_y0;
+    std::vector<float> m_x1;
+    std::vector<float> m_y1;
+    std::vector<float> m_areas;
+    std::vector<float> m_iou;
+};
+
+/**
+ * @brief Moves the k best elements according to the strict ordering comp to the beginning of [first, first + n) and
+ * sorts them. The selection is linear in n, so it is noticeably faster than the partial sort for thousands of
+ * candidate boxes, and gives the same result when comp has no ties (e.g. the index breaks the equal scores).
+ */
+template <typename T, typename Compare>
+void select_top_k(T* first, const size_t n, const size_t k, Compare comp) {
+    if (k == 0)
+        return;
+    if (k < n)
+        std::nth_element(first, first + k - 1, first + n, comp);
+    std::sort(first, first + std::min(k, n), comp);
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_gemm.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+// the rows of src processed together, the innermost loops over them are vectorized by the compiler
+static constexpr size_t m_block = 8;
+// the output channels processed by one work item
+static constexpr size_t n_block = 64;
+
+void sparse_gemm(const float* src, float* dst, const size_t M, const size_t N, const size_t K,
+                 const int32_t* offsets, const int32_t* columns, const float* values, const float* bias) {
+    const size_t m_blocks = (M + m_block - 1) / m_block;
+    const size_t n_blocks = (N + n_block - 1) / n_block;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(m_blocks * n_blocks, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        // the block of rows is transposed, so each nonzero weight is multiplied by m_block consecutive values;
+        // the work items are ordered by the row blocks, so the thread transposes the block only when it changes
+        std::vector<float> src_t(K * m_block);
+        size_t transposed = m_blocks;
+        for (size_t item = start; item < end; item++) {
+            const size_t mb = item / n_blocks;
+            const size_t m0 = mb * m_block;
+            const size_t rows = std::min(m_block, M - m0);
+            const size_t n_end = std::min(N, (item % n_blocks + 1) * n_block);
+
+            if (rows == 1) {
+                // a single row (e.g. the next token of a decoder) reads the nonzero weights only once anyway
+                const float* s = src + m0 * K;
+                for (size_t n = (item % n_blocks) * n_block; n < n_end; n++) {
+                    float acc = 0.f;
+                    for (int32_t j = offsets[n]; j < offsets[n + 1]; j++)
+                        acc += values[j] * s[columns[j]];
+                    dst[m0 * N + n] = bias ? acc + bias[n] : acc;
+                }
+                continue;
+            }
+
+            if (transposed != mb) {
+                for (size_t k = 0; k < K; k++) {
+                    for (size_t r = 0; r < m_block; r++)
+                        src_t[k * m_block + r] = r < rows ? src[(m0 + r) * K + k] : 0.f;
+                }
+                transposed = mb;
+            }
+            for (size_t n = (item % n_blocks) * n_block; n < n_end; n++) {
+                float acc[m_block] = {};
+                for (int32_t j = offsets[n]; j < offsets[n + 1]; j++) {
+                    const float w = values[j];
+                    const float* s = &src_t[static_cast<size_t>(columns[j]) * m_block];
+                    for (size_t r = 0; r < m_block; r++)
+                        acc[r] += w * s[r];
+                }
+                const float b = bias ? bias[n] : 0.f;
+                for (size_t r = 0; r < rows; r++)
+                    dst[(m0 + r) * N + n] = acc[r] + b;
+            }
+        }
+    });
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
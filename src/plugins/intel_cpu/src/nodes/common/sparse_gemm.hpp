@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+// Computes dst[M, N] = src[M, K] * W^T (+ bias[N]) for the weights W[N, K] compressed in the CSR format: the nonzero
+// values of the output channel n and their input channel indices are [offsets[n], offsets[n + 1]) of values and columns.
+void sparse_gemm(const float* src, float* dst, const size_t M, const size_t N, const size_t K,
+                 const int32_t* offsets, const int32_t* columns, const float* values, const float* bias);
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
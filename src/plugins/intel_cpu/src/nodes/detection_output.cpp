@@ -5,11 +5,13 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <numeric>
 
 #include <onednn/dnnl.h>
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "detection_output.h"
+#include "common/box_utils.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -265,30 +267,30 @@ void DetectionOutput::execute(dnnl::stream strm) {
     }
 
     // NMS
-    for (int n = 0; n < imgNum; ++n) {
-        if (!decreaseClassId) {
-            // Caffe style
-            parallel_for(classesNum, [&](int c) {
-                if (c != backgroundClassId) {  // Ignore background class
-                    int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pdetections = detectionsData + n * classesNum + c;
-
-                    const float *pboxes;
-                    const float *psizes;
-                    if (isShareLoc) {
-                        pboxes = decodedBboxesData + n * 4 * priorsNum;
-                        psizes = bboxSizesData + n * priorsNum;
-                    } else {
-                        pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
-                        psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
-                    }
-
-                    NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+    if (!decreaseClassId) {
+        // Caffe style
+        parallel_for2d(imgNum, classesNum, [&](int n, int c) {
+            if (c != backgroundClassId) {  // Ignore background class
+                int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
+                int *pdetections = detectionsData + n * classesNum + c;
+
+                const float *pboxes;
+                const float *psizes;
+                if (isShareLoc) {
+                    pboxes = decodedBboxesData + n * 4 * priorsNum;
+                    psizes = bboxSizesData + n * priorsNum;
+                } else {
+                    pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
+                    psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
                 }
-            });
-        } else {
-            // MXNet style
+
+                NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+            }
+        });
+    } else {
+        // MXNet style
+        parallel_for(imgNum, [&](int n) {
             int *pbuffer = indicesBufData + n * classesNum * priorsNum;
             int *pdetections = detectionsData + n * classesNum;
             int *pindices = indicesData + n * classesNum * priorsNum;
@@ -296,47 +298,43 @@ void DetectionOutput::execute(dnnl::stream strm) {
             const float *psizes = bboxSizesData + n * locNumForClasses * priorsNum;
 
             NMSMX(pbuffer, pdetections, pindices, pboxes, psizes);
-        }
-
-        int detectionsTotal = 0;
-        detectionsTotal = parallel_sum(classesNum, detectionsTotal, [&](size_t c)->int {
-            return detectionsData[n * classesNum + c];
         });
+    }
 
-        // combine detections of all class for this image and filter with global(image) topk(keep_topk)
-        if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
-
-            std::mutex mtx;
-            parallel_for(classesNum, [&](int c) {
-                int detections = detectionsData[n * classesNum + c];
-                int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
-
-                float *pconf  = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
+    // combine detections of all class for each image and filter with global(image) topk(keep_topk)
+    if (keepTopK > -1) {
+        parallel_for(imgNum, [&](int n) {
+            int *pdetections = detectionsData + n * classesNum;
+            const int detectionsTotal = std::accumulate(pdetections, pdetections + classesNum, 0);
+            if (detectionsTotal <= keepTopK)
+                return;
 
-                for (int i = 0; i < detections; ++i) {
+            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            confIndicesClassMap.reserve(detectionsTotal);
+            for (int c = 0; c < classesNum; ++c) {
+                const int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                const float *pconf  = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
+                for (int i = 0; i < pdetections[c]; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
                     confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
                 }
-            });
+            }
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            select_top_k(confIndicesClassMap.data(), confIndicesClassMap.size(), keepTopK,
+                         SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
-            memset(detectionsData + n * classesNum, 0, classesNum * sizeof(int));
+            memset(pdetections, 0, classesNum * sizeof(int));
 
             for (size_t j = 0; j < confIndicesClassMap.size(); ++j) {
                 int cls = confIndicesClassMap[j].second.first;
                 int pr = confIndicesClassMap[j].second.second;
                 int *pindices = indicesData + n * classesNum * priorsNum + cls * priorsNum;
-                pindices[detectionsData[n * classesNum + cls]] = pr;
-                detectionsData[n * classesNum + cls]++;
+                pindices[pdetections[cls]] = pr;
+                pdetections[cls]++;
             }
-        }
+        });
     }
 
     // get final output
@@ -719,47 +717,9 @@ inline void DetectionOutput::decodeBBoxes(const float *priorData,
     });
 }
 
-inline void DetectionOutput::topk(const int *indicesIn, int *indicesOut, const float *conf, int n, int k) {
-    std::partial_sort_copy(indicesIn, indicesIn + n,
-                           indicesOut, indicesOut + k,
-                           ConfidenceComparatorDO(conf));
-}
-
-static inline float JaccardOverlap(const float *decodedBbox,
-                                   const float *bboxSizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decodedBbox[idx1 * 4 + 0];
-    float ymin1 = decodedBbox[idx1 * 4 + 1];
-    float xmax1 = decodedBbox[idx1 * 4 + 2];
-    float ymax1 = decodedBbox[idx1 * 4 + 3];
-
-    float xmin2 = decodedBbox[idx2 * 4 + 0];
-    float ymin2 = decodedBbox[idx2 * 4 + 1];
-    float xmax2 = decodedBbox[idx2 * 4 + 2];
-    float ymax2 = decodedBbox[idx2 * 4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersectXMin = (std::max)(xmin1, xmin2);
-    float intersectYMin = (std::max)(ymin1, ymin2);
-    float intersectXMax = (std::min)(xmax1, xmax2);
-    float intersectYMax = (std::min)(ymax1, ymax2);
-
-    float intersectWidth  = intersectXMax - intersectXMin;
-    float intersectHeight = intersectYMax - intersectYMin;
-
-    if (intersectWidth <= 0 || intersectHeight <= 0) {
-        return 0.0f;
-    }
-
-    float intersectSize = intersectWidth * intersectHeight;
-    float bbox1Size = bboxSizes[idx1];
-    float bbox2Size = bboxSizes[idx2];
-
-    return intersectSize / (bbox1Size + bbox2Size - intersectSize);
+inline void DetectionOutput::topk(int *indicesIn, int *indicesOut, const float *conf, int n, int k) {
+    select_top_k(indicesIn, n, k, ConfidenceComparatorDO(conf));
+    std::copy_n(indicesIn, k, indicesOut);
 }
 
 inline void DetectionOutput::NMSCF(int* indicesIn,
@@ -770,21 +730,19 @@ inline void DetectionOutput::NMSCF(int* indicesIn,
     // nms for this class
     int countIn = detections;
     detections = 0;
+    const auto suppresses = [this](float overlap) {
+        return overlap > NMSThreshold;
+    };
+    BoxesSoA keptBoxes;
+    keptBoxes.reserve(countIn);
     for (int i = 0; i < countIn; ++i) {
         const int prior = indicesIn[i];
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int keptPrior = indicesOut[k];
-            float overlap = JaccardOverlap(bboxes, boxSizes, prior, keptPrior);
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
+        bool keep = !keptBoxes.any_iou(bboxes + prior * 4, boxSizes[prior], 0.0f, iou_mode::detection_output, suppresses);
         if (keep) {
             indicesOut[detections] = prior;
             detections++;
+            keptBoxes.push_back(bboxes + prior * 4, boxSizes[prior]);
         }
     }
 }
@@ -798,6 +756,10 @@ inline void DetectionOutput::NMSMX(int* indicesIn,
     int countIn = detections[0];
     detections[0] = 0;
 
+    const auto suppresses = [this](float overlap) {
+        return overlap > NMSThreshold;
+    };
+    std::vector<BoxesSoA> keptBoxes(classesNum);
     for (int i = 0; i < countIn; ++i) {
         const int idx = indicesIn[i];
         const int cls = idx / priorsNum;
@@ -806,24 +768,12 @@ inline void DetectionOutput::NMSMX(int* indicesIn,
         // nms within this class
         int &ndetection = detections[cls];
         int *pindices = indicesOut + cls * priorsNum;
+        const int boxIdx = isShareLoc ? prior : cls * priorsNum + prior;
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int keptPrior = pindices[k];
-            float overlap = 0.0f;
-            if (isShareLoc) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, keptPrior);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls * priorsNum + prior, cls * priorsNum + keptPrior);
-            }
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-
+        bool keep = !keptBoxes[cls].any_iou(bboxes + boxIdx * 4, sizes[boxIdx], 0.0f, iou_mode::detection_output, suppresses);
         if (keep) {
             pindices[ndetection++] = prior;
+            keptBoxes[cls].push_back(bboxes + boxIdx * 4, sizes[boxIdx]);
         }
     }
 }
@@ -94,7 +94,7 @@ private:
     inline void NMSMX(int* indicesIn, int* detections, int* indicesOut,
         const float* bboxes, const float* sizes);
 
-    inline void topk(const int* indicesIn, int* indicesOut, const float* conf, int n, int k);
+    inline void topk(int* indicesIn, int* indicesOut, const float* conf, int n, int k);
 
     inline void generateOutput(float* reorderedConfData, int* indicesData, int* detectionsData, float* decodedBboxesData, float* dstData);
 
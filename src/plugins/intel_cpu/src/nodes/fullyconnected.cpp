@@ -26,8 +26,14 @@
 #include "common/primitive_desc.hpp"
 #include "common/primitive_desc_iface.hpp"
 #include "common/cpu_convert.h"
+#include "common/sparse_gemm.hpp"
 #include "shape_inference/custom/fullyconnected.hpp"
+#include "ie_parallel.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -93,6 +99,31 @@ bool FCKey::operator==(const FCKey &rhs) const {
     return retVal;
 }
 
+// The symmetric int8 quantization shared by the weights and the inputs, so both round the same way
+inline float quantizeValue(float value, float invScale) {
+    return std::round(value * invScale);
+}
+
+// Quantizes the output channel of the fp32 weights to int8 with the symmetric scale, which is returned. The K values of
+// the channel are strided by the stride. The squared quantization error and the squared norm of the channel are added to
+// error and norm (they become non-finite for the non-finite weights), dst may be null when only the error is needed.
+float quantizeWeightsChannel(const float* src, size_t K, size_t stride, int8_t* dst, double& error, double& norm) {
+    float absMax = 0.f;
+    for (size_t k = 0; k < K; k++)
+        absMax = std::max(absMax, std::abs(src[k * stride]));
+    const float scale = absMax / 127.f;
+    const float invScale = absMax > 0.f ? 127.f / absMax : 0.f;
+    for (size_t k = 0; k < K; k++) {
+        const float w = src[k * stride];
+        const float q = quantizeValue(w, invScale);
+        error += (w - q * scale) * (w - q * scale);
+        norm += w * w;
+        if (dst)
+            dst[k] = static_cast<int8_t>(q);
+    }
+    return scale;
+}
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -243,6 +274,11 @@ void FullyConnected::getSupportedDescriptors() {
 
     inDims = isDynamicNode() ? makeDummyInputDims() : getInputShapeAtPort(DATA_ID).getStaticDims();
     outDims = isDynamicNode() ? makeDummyOutputDims(inDims) : getOutputShapeAtPort(0).getStaticDims();
+    useSparseGemm = !useSparseWeights && !useWeightsDecompressionImpl && canUseSparseGemm(inputDataType, weightsDataType);
+    if (useSparseGemm) return;
+    useDynamicQuantization = !useSparseWeights && !useWeightsDecompressionImpl &&
+                             canUseDynamicQuantization(inputDataType, weightsDataType);
+    if (useDynamicQuantization) return;
 #if defined(OV_CPU_WITH_MLAS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
     // MLAS doesn't support post-ops fusing and only supports FP32. INT8 is not enabled yet
     // Disable MLAS when FC could fuse post-ops
@@ -330,6 +366,16 @@ void FullyConnected::prepackMLASWeight() {
 #endif
 
 void FullyConnected::createPrimitive() {
+    if (useSparseGemm) {
+        Node::createPrimitive();
+        prepackSparseWeights();
+        return;
+    }
+    if (useDynamicQuantization) {
+        Node::createPrimitive();
+        prepackQuantizedWeights();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         Node::createPrimitive();
@@ -360,6 +406,14 @@ void FullyConnected::prepareParams() {
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+    if (useSparseGemm) {
+        const auto& dstDims = dstMemPtr->getStaticDims();
+        sparseGemmM = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t(1), std::multiplies<size_t>());
+        return;
+    }
+    if (useDynamicQuantization) {
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     // M should be normalized and updated
     if (useMlas) {
@@ -474,10 +528,11 @@ void FullyConnected::prepareParams() {
 
         if (!prevExecPtr || !execPtr->getWeightDesc()->isCompatible(*(prevExecPtr->getWeightDesc()))) {
             if (weightsNonTransposed) {
-                primArgs[DNNL_ARG_WEIGHTS] = prepareWeightMemory(execPtr->getWeightDesc(), makeTransposedWeightDescriptor())->getPrimitive();
+                packedWeightsPtr = prepareWeightMemory(execPtr->getWeightDesc(), makeTransposedWeightDescriptor());
             } else {
-                primArgs[DNNL_ARG_WEIGHTS] = prepareWeightMemory(execPtr->getWeightDesc())->getPrimitive();
+                packedWeightsPtr = prepareWeightMemory(execPtr->getWeightDesc());
             }
+            primArgs[DNNL_ARG_WEIGHTS] = packedWeightsPtr->getPrimitive();
         }
         // changed shapes may also cause the kernel type changed
         selected_pd->setImplementationType(execPtr->getImplementationType());
@@ -532,6 +587,14 @@ void FullyConnected::executeMLAS() {
 #endif
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useSparseGemm) {
+        executeSparseGemm();
+        return;
+    }
+    if (useDynamicQuantization) {
+        executeDynamicQuantization();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         executeMLAS();
@@ -640,6 +703,8 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::unknown,
         impl_desc_type::acl,
         impl_desc_type::brgemm_sparse_avx512_amx,
+        impl_desc_type::gemm_sparse,
+        impl_desc_type::gemm_dyn_quant,
         impl_desc_type::brgemm_avx512_amx,
         impl_desc_type::brgemm_avx512,
         impl_desc_type::brgemm_avx2,
@@ -773,19 +838,22 @@ void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDes
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
-    if (useMlas) {
+    if (useMlas || useSparseGemm || useDynamicQuantization) {
         auto dataPrecision = getOriginalInputPrecisionAtPort(0);
+        const auto implType = useSparseGemm ? impl_desc_type::gemm_sparse
+                              : useDynamicQuantization ? impl_desc_type::gemm_dyn_quant
+                              : impl_desc_type::gemm_mlas;
         if (withBiases) {
             addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                             {LayoutType::ncsp, dataPrecision},
                             {LayoutType::ncsp, dataPrecision}},
                             {{LayoutType::ncsp, dataPrecision}},
-                            impl_desc_type::gemm_mlas);
+                            implType);
         } else {
             addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                 {LayoutType::ncsp, dataPrecision}},
                 {{LayoutType::ncsp, dataPrecision}},
-                impl_desc_type::gemm_mlas);
+                implType);
         }
         return;
     }
@@ -886,6 +954,18 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
     return getMaxPrecision(inputPrecisions);
 }
 
+MemoryCPtr FullyConnected::getWeightsMemory() const {
+    if (useSparseGemm)
+        return sparseWeightsPtr;
+    if (useDynamicQuantization)
+        return quantizedWeightsPtr;
+#ifdef OV_CPU_WITH_MLAS
+    if (useMlas)
+        return mlasPackedPtr;
+#endif
+    return packedWeightsPtr;
+}
+
 void FullyConnected::initOptimalPrimitiveDescriptor() {
     Node::initOptimalPrimitiveDescriptor();
     auto selectedPD = getSelectedPrimitiveDescriptor();
@@ -1067,6 +1147,285 @@ bool FullyConnected::useSparseWeightsDecompression() {
     return true;
 }
 
+bool FullyConnected::canUseSparseGemm(memory::data_type inputDataType, memory::data_type weightsDataType) {
+    // minSparseRate == 1 means that sparse feature is switched off
+    if (minSparseRate == 1.f)
+        return false;
+
+    // the sparse kernel covers what MLAS does: fp32 without post-ops, 2D weights and per channel bias
+    if (inputDataType != memory::data_type::f32 || weightsDataType != memory::data_type::f32 || !fusedWith.empty())
+        return false;
+
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    if (weiDims.size() != 2 || weiDims[0] * weiDims[1] >= static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return false;
+
+    if (withBiases) {
+        const auto& biasDims = getInputShapeAtPort(BIAS_ID).getStaticDims();
+        if (biasDims.back() != outDims.back() ||
+            std::any_of(biasDims.begin(), biasDims.end() - 1, [](size_t dim) { return dim != 1; }))
+            return false;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!constNode)
+        return false;
+    auto blb = constNode->getMemoryPtr();
+    if (blb == nullptr)
+        IE_THROW() << "Cannot get const blob for node " << getName() << ".";
+
+    const auto weightsData = reinterpret_cast<const float*>(blb->getData());
+    const auto elementsCount = blb->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
+    if (elementsCount == 0)
+        return false;
+    const size_t zerosCount = parallel_sum(elementsCount, size_t(0), [&](size_t i) -> size_t {
+        return weightsData[i] == 0.f ? 1 : 0;
+    });
+    const float sparseRate = static_cast<float>(zerosCount) / static_cast<float>(elementsCount);
+
+    DEBUG_LOG(getName(), " | fp32 sparse rate = ", sparseRate * 100, "%, min sparse rate = ", minSparseRate * 100,
+              "%, use sparse gemm = ", sparseRate >= minSparseRate);
+
+    return sparseRate >= minSparseRate;
+}
+
+void FullyConnected::prepackSparseWeights() {
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+
+    // the weights are [N, K], or [K, N] when they are kept non transposed
+    const auto& wgtDims = weightsMem->getStaticDims();
+    const size_t N = weightsNonTransposed ? wgtDims[1] : wgtDims[0];
+    const size_t K = weightsNonTransposed ? wgtDims[0] : wgtDims[1];
+
+    auto create = [&]() {
+        const float* weights = reinterpret_cast<const float*>(weightsMem->getData());
+        auto weight = [&](size_t n, size_t k) {
+            return weightsNonTransposed ? weights[k * N + n] : weights[n * K + k];
+        };
+
+        std::vector<int32_t> offsets(N + 1, 0);
+        parallel_for(N, [&](size_t n) {
+            int32_t nnz = 0;
+            for (size_t k = 0; k < K; k++)
+                nnz += weight(n, k) != 0.f;
+            offsets[n + 1] = nnz;
+        });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        const size_t nnz = offsets[N];
+
+        // the packed layout is: offsets[N + 1], columns[nnz], values[nnz]
+        const size_t packedSize = (N + 1 + nnz) * sizeof(int32_t) + nnz * sizeof(float);
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(Precision::I8, intel_cpu::Shape{packedSize}));
+        auto packedOffsets = reinterpret_cast<int32_t*>(_ptr->getData());
+        auto packedColumns = packedOffsets + N + 1;
+        auto packedValues = reinterpret_cast<float*>(packedColumns + nnz);
+        std::copy(offsets.begin(), offsets.end(), packedOffsets);
+        parallel_for(N, [&](size_t n) {
+            int32_t j = offsets[n];
+            for (size_t k = 0; k < K; k++) {
+                const float w = weight(n, k);
+                if (w != 0.f) {
+                    packedColumns[j] = static_cast<int32_t>(k);
+                    packedValues[j] = w;
+                    j++;
+                }
+            }
+        });
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "gemm_sparse_" + std::to_string(N) + "_" + std::to_string(K);
+        const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+
+        sparseWeightsPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        sparseWeightsPtr = create();
+    }
+}
+
+void FullyConnected::executeSparseGemm() {
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto biasMemPtr = withBiases ? getParentEdgeAt(BIAS_ID)->getMemoryPtr() : nullptr;
+    const size_t N = dstMemPtr->getStaticDims().back();
+    const size_t K = srcMemPtr->getStaticDims().back();
+
+    const auto offsets = reinterpret_cast<const int32_t*>(sparseWeightsPtr->getData());
+    const auto columns = offsets + N + 1;
+    const auto values = reinterpret_cast<const float*>(columns + offsets[N]);
+    XARCH::sparse_gemm(reinterpret_cast<const float*>(srcMemPtr->getData()),
+                       reinterpret_cast<float*>(dstMemPtr->getData()),
+                       sparseGemmM, N, K, offsets, columns, values,
+                       withBiases ? reinterpret_cast<const float*>(biasMemPtr->getData()) : nullptr);
+}
+
+bool FullyConnected::canUseDynamicQuantization(memory::data_type inputDataType, memory::data_type weightsDataType) {
+    // post-ops aren't applied to the dequantized output, so the layers with the fused operations stay in fp32
+    if (!context->getConfig().fcDynamicQuantization || inputDataType != memory::data_type::f32 ||
+        weightsDataType != memory::data_type::f32 || !fusedWith.empty())
+        return false;
+
+    // int8 GEMM outperforms fp32 one only with the int8 dot product instructions
+    if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_vnni) && !impl::cpu::x64::mayiuse(impl::cpu::x64::avx2_vnni))
+        return false;
+
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    if (weiDims.size() != 2)
+        return false;
+    const size_t N = weightsNonTransposed ? weiDims[1] : weiDims[0];
+    const size_t K = weightsNonTransposed ? weiDims[0] : weiDims[1];
+    // the quantization of the short rows of the input costs as much as their multiplication
+    if (K < 64)
+        return false;
+
+    if (withBiases) {
+        const auto& biasDims = getInputShapeAtPort(BIAS_ID).getStaticDims();
+        if (biasDims.back() != outDims.back() ||
+            std::any_of(biasDims.begin(), biasDims.end() - 1, [](size_t dim) { return dim != 1; }))
+            return false;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!constNode)
+        return false;
+    auto blb = constNode->getMemoryPtr();
+    if (blb == nullptr)
+        IE_THROW() << "Cannot get const blob for node " << getName() << ".";
+
+    // the accuracy guard: the weights with the outliers in the channels lose too much precision with the int8 scale,
+    // such layers (typically the first and the last ones of the model) stay in fp32
+    const auto weights = reinterpret_cast<const float*>(blb->getData());
+    std::vector<double> errors(N, 0.0), norms(N, 0.0);
+    parallel_for(N, [&](size_t n) {
+        if (weightsNonTransposed)
+            quantizeWeightsChannel(weights + n, K, N, nullptr, errors[n], norms[n]);
+        else
+            quantizeWeightsChannel(weights + n * K, K, 1, nullptr, errors[n], norms[n]);
+    });
+    // each channel is checked on its own, so one inaccurate channel isn't hidden by the others, and the channels
+    // with the NaN or infinite weights keep the layer in fp32
+    constexpr double maxRelativeError = 1e-3;
+    for (size_t n = 0; n < N; n++) {
+        if (!std::isfinite(errors[n]) || !std::isfinite(norms[n]) || errors[n] > maxRelativeError * norms[n]) {
+            DEBUG_LOG(getName(), " | weights relative quantization error of channel ", n, " = ",
+                      errors[n] / norms[n], ", use dynamic quantization = false");
+            return false;
+        }
+    }
+    DEBUG_LOG(getName(), " | use dynamic quantization = true");
+
+    return true;
+}
+
+void FullyConnected::prepackQuantizedWeights() {
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+
+    const auto& wgtDims = weightsMem->getStaticDims();
+    const size_t N = weightsNonTransposed ? wgtDims[1] : wgtDims[0];
+    const size_t K = weightsNonTransposed ? wgtDims[0] : wgtDims[1];
+
+    auto create = [&]() {
+        const float* weights = reinterpret_cast<const float*>(weightsMem->getData());
+        // the packed layout is: scales[N], weights[N, K]
+        const size_t packedSize = N * sizeof(float) + N * K;
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(Precision::I8, intel_cpu::Shape{packedSize}));
+        auto scales = reinterpret_cast<float*>(_ptr->getData());
+        auto quantized = reinterpret_cast<int8_t*>(scales + N);
+        parallel_for(N, [&](size_t n) {
+            double error = 0.0, norm = 0.0;
+            if (weightsNonTransposed)
+                scales[n] = quantizeWeightsChannel(weights + n, K, N, quantized + n * K, error, norm);
+            else
+                scales[n] = quantizeWeightsChannel(weights + n * K, K, 1, quantized + n * K, error, norm);
+        });
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "gemm_dyn_quant_" + std::to_string(N) + "_" + std::to_string(K);
+        const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+
+        quantizedWeightsPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        quantizedWeightsPtr = create();
+    }
+}
+
+void FullyConnected::executeDynamicQuantization() {
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto biasMemPtr = withBiases ? getParentEdgeAt(BIAS_ID)->getMemoryPtr() : nullptr;
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    const size_t N = dstDims.back();
+    const size_t K = srcMemPtr->getStaticDims().back();
+    const size_t M = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    if (M == 0)
+        return;
+
+    // each row of the input is quantized with its own scale, so the outliers of one token don't affect the others
+    const auto src = reinterpret_cast<const float*>(srcMemPtr->getData());
+    quantizedSrc.resize(M * K);
+    quantizedSrcScales.resize(M);
+    parallel_for(M, [&](size_t m) {
+        const float* row = src + m * K;
+        int8_t* quantizedRow = quantizedSrc.data() + m * K;
+        float absMax = 0.f;
+        bool isFinite = true;
+        for (size_t k = 0; k < K; k++) {
+            absMax = std::max(absMax, std::abs(row[k]));
+            isFinite = isFinite && std::isfinite(row[k]);
+        }
+        if (!isFinite) {
+            // the row can't be quantized, its outputs become NaN (as the fp32 GEMM would produce NaN or infinities)
+            // rather than the values of the rest of the row
+            std::fill_n(quantizedRow, K, 0);
+            quantizedSrcScales[m] = std::numeric_limits<float>::quiet_NaN();
+            return;
+        }
+        const float invScale = absMax > 0.f ? 127.f / absMax : 0.f;
+        for (size_t k = 0; k < K; k++)
+            quantizedRow[k] = static_cast<int8_t>(quantizeValue(row[k], invScale));
+        quantizedSrcScales[m] = absMax / 127.f;
+    });
+
+    const auto weightsScales = reinterpret_cast<const float*>(quantizedWeightsPtr->getData());
+    const auto weights = reinterpret_cast<const int8_t*>(weightsScales + N);
+    // the int32 accumulators are stored in the destination and dequantized in place, they have the same size
+    auto dst = reinterpret_cast<float*>(dstMemPtr->getData());
+    auto accumulators = reinterpret_cast<int32_t*>(dst);
+    const int32_t zeroOffset = 0;
+    const auto status = dnnl::gemm_s8s8s32('N', 'T', 'F', M, N, K, 1.f, quantizedSrc.data(), K, 0,
+                                           weights, K, 0, 0.f, accumulators, N, &zeroOffset);
+    if (status != dnnl::status::success)
+        IE_THROW() << errorPrefix << " failed to execute int8 gemm";
+
+    const auto bias = withBiases ? reinterpret_cast<const float*>(biasMemPtr->getData()) : nullptr;
+    parallel_for(M, [&](size_t m) {
+        const float srcScale = quantizedSrcScales[m];
+        float* dstRow = dst + m * N;
+        const int32_t* accRow = accumulators + m * N;
+        for (size_t n = 0; n < N; n++) {
+            const float value = static_cast<float>(accRow[n]) * srcScale * weightsScales[n];
+            dstRow[n] = bias ? value + bias[n] : value;
+        }
+    });
+}
+
 void FullyConnected::fuseDecompressionMultiply(const NodePtr& constData) {
     fuseDecompressionConstant(constData, decompressionMultiply);
 }
@@ -48,6 +48,7 @@ public:
     std::shared_ptr<MemoryDesc> getDstMemDesc(const dnnl::primitive_desc &prim_desc, size_t idx) const override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
+    MemoryCPtr getWeightsMemory() const override;
 
     bool canFuse(const NodePtr& node) const override;
 
@@ -88,6 +89,7 @@ private:
 
     using executorPtr = std::shared_ptr<DnnlExecutor>;
     executorPtr execPtr = nullptr;
+    MemoryPtr packedWeightsPtr = nullptr;
     bool useConv1x1 = false;
     impl_desc_type implementationTypeIP = impl_desc_type::unknown;
     MemoryDescPtr weightDescIP;
@@ -109,6 +111,21 @@ private:
     float minSparseRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
+    // fp32 weights with the most of the values equal to zero are compressed in CSR and multiplied by the sparse kernel
+    bool useSparseGemm = false;
+    size_t sparseGemmM = 0;
+    MemoryPtr sparseWeightsPtr = nullptr;
+    bool canUseSparseGemm(dnnl::memory::data_type inputDataType, dnnl::memory::data_type weightsDataType);
+    void prepackSparseWeights();
+    void executeSparseGemm();
+    // fp32 weights are quantized to int8 per output channel, the input is quantized per row at runtime
+    bool useDynamicQuantization = false;
+    MemoryPtr quantizedWeightsPtr = nullptr;
+    std::vector<int8_t> quantizedSrc;
+    std::vector<float> quantizedSrcScales;
+    bool canUseDynamicQuantization(dnnl::memory::data_type inputDataType, dnnl::memory::data_type weightsDataType);
+    void prepackQuantizedWeights();
+    void executeDynamicQuantization();
     VectorDims expectedBiasDims {};
     bool useMlas = false;
 #ifdef OV_CPU_WITH_MLAS
@@ -10,6 +10,7 @@
 #include "common/cpu_memcpy.h"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -45,6 +46,12 @@ void If::PortMapHelper::redefineTo() {
     }
 }
 
+void If::PortBinder::bind() {
+    auto data = extMemPtr->getData();
+    if (bodyMemPtr->getData() != data)
+        bodyMemPtr->getMemoryMngr()->setExtBuff(data, extMemPtr->getSize());
+}
+
 bool If::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(), ov::op::v8::If::get_type_info_static())) {
@@ -71,6 +78,9 @@ void If::getSupportedDescriptors() {
 
     const std::shared_ptr<const ov::Model>& thenBody = ifOp->get_then_body();
     const std::shared_ptr<const ov::Model>& elseBody = ifOp->get_else_body();
+    // only the taken branch pays for the weights preparation, the other one may never be executed
+    subGraphThen.SetLazyPreparation(true);
+    subGraphElse.SetLazyPreparation(true);
     subGraphThen.CreateGraph(thenBody, context);
     subGraphElse.CreateGraph(elseBody, context);
 
@@ -79,6 +89,7 @@ void If::getSupportedDescriptors() {
         auto inNode = inMapThen.find(param->get_friendly_name());
         if (inNode != inMapThen.end()) {
             inputMemThen.push_back(getToMemories(inNode->second.get(), 0));
+            inputNodesThen.push_back(inNode->second);
         } else {
             IE_THROW() << "Then body of node If with name " << getName() << " does not have input with name: "
                     << param->get_friendly_name();
@@ -90,6 +101,7 @@ void If::getSupportedDescriptors() {
         auto inNode = inMapElse.find(param->get_friendly_name());
         if (inNode != inMapElse.end()) {
             inputMemElse.push_back(getToMemories(inNode->second.get(), 0));
+            inputNodesElse.push_back(inNode->second);
         } else {
             IE_THROW() << "Else body of node If with name " << getName() << " does not have input with name: "
                     << param->get_friendly_name();
@@ -104,6 +116,7 @@ void If::getSupportedDescriptors() {
         if (outNode != outMapThen.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             outputMemThen.push_back(outMem);
+            outputNodesThen.push_back(outNode->second);
         } else {
             IE_THROW() << "Then body of node If with name " << getName() << " does not have output with name: "
                     << inputID;
@@ -118,6 +131,7 @@ void If::getSupportedDescriptors() {
         if (outNode != outMapElse.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             outputMemElse.push_back(outMem);
+            outputNodesElse.push_back(outNode->second);
         } else {
             IE_THROW() << "Else body of node If with name " << getName() << " does not have output with name: "
                     << inputID;
@@ -188,11 +202,20 @@ void If::createPrimitive() {
 void If::prepareBeforeMappers(const bool isThen, const dnnl::engine& eng) {
     auto &inputPortMap = isThen ? thenInputPortMap : elseInputPortMap;
     auto &inputMems = isThen ? inputMemThen : inputMemElse;
+    auto &inputNodes = isThen ? inputNodesThen : inputNodesElse;
     auto &beforeMappers = isThen ? beforeThenMappers : beforeElseMappers;
+    auto &binders = isThen ? thenBinders : elseBinders;
+    const auto &subGraph = isThen ? subGraphThen : subGraphElse;
+    const bool canBind = !isDynamicNode() && subGraph.getStatus() == Graph::Status::ReadyStatic;
     for (auto& map_rule : inputPortMap) {
         auto fromMem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &toMems = inputMems[map_rule.to];
 
+        if (canBind && canBindInput(inputNodes[map_rule.to], fromMem)) {
+            for (auto& toMem : toMems)
+                binders.emplace_back(fromMem, toMem);
+            continue;
+        }
         beforeMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
     }
 }
@@ -200,15 +223,71 @@ void If::prepareBeforeMappers(const bool isThen, const dnnl::engine& eng) {
 void If::prepareAfterMappers(const bool isThen, const dnnl::engine& eng) {
     auto &outputPortMap = isThen ? thenOutputPortMap : elseOutputPortMap;
     auto &outputMems = isThen ? outputMemThen : outputMemElse;
+    auto &outputNodes = isThen ? outputNodesThen : outputNodesElse;
     auto &afterMappers = isThen ? afterThenMappers : afterElseMappers;
+    auto &binders = isThen ? thenBinders : elseBinders;
+    const auto &subGraph = isThen ? subGraphThen : subGraphElse;
+    const bool canBind = !isDynamicNode() && subGraph.getStatus() == Graph::Status::ReadyStatic;
+    std::vector<bool> bound(outputMems.size(), false);
     for (auto& map_rule : outputPortMap) {
         auto toMems = getToMemories(this, map_rule.from);
         auto &fromMem = outputMems[map_rule.to];
 
+        // a body output can be bound to one If output only, it is copied to the other If outputs it is mapped to
+        if (canBind && !toMems.empty() && !bound[map_rule.to] &&
+            canBindOutput(outputNodes[map_rule.to], toMems.front())) {
+            // the child edges of the If output share the same memory, so binding to the first one covers all of them
+            IE_ASSERT(std::all_of(toMems.begin(), toMems.end(), [&](const MemoryPtr& mem) {
+                return mem->getData() == toMems.front()->getData();
+            })) << "If node with name " << getName() << " has output " << map_rule.from << " with unshared memory";
+            binders.emplace_back(toMems.front(), fromMem);
+            bound[map_rule.to] = true;
+            continue;
+        }
         afterMappers.emplace_back(std::make_shared<PortMapHelper>(fromMem, toMems, eng));
     }
 }
 
+bool If::canBindInput(const NodePtr& bodyInput, const MemoryPtr& extMem) const {
+    const auto& extDesc = extMem->getDesc();
+    if (!extDesc.isDefined())
+        return false;
+
+    // the same checks as for the zero-copy of the user input: the body must not write to the external data
+    const auto& childEdges = bodyInput->getChildEdges();
+    for (const auto& childEdge : childEdges) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << bodyInput->getName() << " contains empty child edge";
+
+        const auto& child = ce->getChild();
+        if (child->isConstant() || ce->inPlace(Edge::LOOK_DOWN) || ce->modifiedInPlace() ||
+            (child->getType() == Type::Concatenation && child->isInPlace()))
+            return false;
+
+        const auto& bodyDesc = ce->getMemory().getDesc();
+        if (!bodyDesc.isDefined() || !bodyDesc.isCompatible(extDesc))
+            return false;
+    }
+    return !childEdges.empty();
+}
+
+bool If::canBindOutput(const NodePtr& bodyOutput, const MemoryPtr& extMem) const {
+    const auto& extDesc = extMem->getDesc();
+    if (!extDesc.isDefined())
+        return false;
+
+    // the body output must be produced to the own memory of the node, which isn't read by the other body nodes
+    auto parentEdge = bodyOutput->getParentEdgeAt(0);
+    const auto& parent = parentEdge->getParent();
+    if (parent->getType() == Type::Input || parent->getChildEdges().size() != 1 || parent->isConstant() ||
+        parent->isInPlace())
+        return false;
+
+    const auto& bodyDesc = parentEdge->getMemory().getDesc();
+    return bodyDesc.isDefined() && bodyDesc.isCompatible(extDesc);
+}
+
 std::deque<MemoryPtr> If::getToMemories(const Node* node, const size_t port) const {
     std::deque<MemoryPtr> memories;
     for (auto edge : node->getChildEdgesAtPort(port))
@@ -222,7 +301,10 @@ void If::execute(dnnl::stream strm) {
     auto& beforeMappers = condition ? beforeThenMappers : beforeElseMappers;
     auto& afterMappers = condition ? afterThenMappers : afterElseMappers;
     auto& subGraph = condition ? subGraphThen : subGraphElse;
+    auto& binders = condition ? thenBinders : elseBinders;
 
+    for (auto &binder : binders)
+        binder.bind();
     for (auto &mapper : beforeMappers)
         mapper->execute(strm);
     subGraph.ResetInferCount();
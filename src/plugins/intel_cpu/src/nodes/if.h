@@ -35,6 +35,8 @@ protected:
 private:
     void prepareBeforeMappers(const bool isThen, const dnnl::engine& eng);
     void prepareAfterMappers(const bool isThen, const dnnl::engine& eng);
+    bool canBindInput(const NodePtr& bodyInput, const MemoryPtr& extMem) const;
+    bool canBindOutput(const NodePtr& bodyOutput, const MemoryPtr& extMem) const;
 
     std::deque<MemoryPtr> getToMemories(const Node* node, const size_t port) const;
 
@@ -58,11 +60,29 @@ private:
         ptrdiff_t size;
     };
 
+    /**
+     * @brief Makes the body memory refer to the data of the external memory of the If node, so the port doesn't need
+     * the copy. The binding is refreshed before every execution, as the external data may be moved between the calls.
+     */
+    class PortBinder {
+    public:
+        PortBinder(const MemoryPtr& extMem, const MemoryPtr& bodyMem) : extMemPtr(extMem), bodyMemPtr(bodyMem) {}
+        void bind();
+
+    private:
+        MemoryPtr extMemPtr;
+        MemoryPtr bodyMemPtr;
+    };
+
     ExtensionManager::Ptr ext_mng;
     Graph subGraphThen;
     Graph subGraphElse;
     std::vector<std::deque<MemoryPtr>> inputMemThen, inputMemElse;
     std::deque<MemoryPtr> outputMemThen, outputMemElse;
+    std::vector<NodePtr> inputNodesThen, inputNodesElse;
+    std::vector<NodePtr> outputNodesThen, outputNodesElse;
+
+    std::vector<PortBinder> thenBinders, elseBinders;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         beforeThenMappers,
@@ -14,6 +14,7 @@
 #include "ie_parallel.hpp"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
+#include "common/box_utils.h"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
@@ -153,23 +154,6 @@ static inline float boxArea(const float* bbox, const bool normalized) {
     }
 }
 
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
 }  // namespace
 
 size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
@@ -191,23 +175,49 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
         return scoresData[a] > scoresData[b];
     });
 
+    // the sorted candidates are gathered to the structure of arrays layout, so each row of the IoU matrix is computed
+    // by the vectorized kernel
+    std::vector<float> x0(originalSize), y0(originalSize), x1(originalSize), y1(originalSize), areas(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        const float* box = boxesData + candidateIndex[i] * 4;
+        x0[i] = box[0];
+        y0[i] = box[1];
+        x1[i] = box[2];
+        y1[i] = box[3];
+        areas[i] = boxArea(box, m_normalized);
+    }
+
+    const float norm = m_normalized ? 0.f : 1.f;
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (size_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
+        float* iouRow = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        const float box[4] = {x0[actual_index], y0[actual_index], x1[actual_index], y1[actual_index]};
+        XARCH::box_iou(box, areas[actual_index], x0.data(), y0.data(), x1.data(), y1.data(), areas.data(),
+                       actual_index, norm, iou_mode::matrix_nms, iouRow);
+        float max_iou = 0.;
+        for (size_t j = 0; j < actual_index; j++)
+            max_iou = std::max(max_iou, iouRow[j]);
         iouMax[actual_index] = max_iou;
     });
 
+    // the decayed scores of the candidates do not depend on each other, only the compaction of the results is serial
+    std::vector<float> decayedScores(originalSize);
+    InferenceEngine::parallel_for(originalSize - 1, [&](size_t idx) {
+        const int64_t i = idx + 1;
+        float minDecay = 1.;
+        for (int64_t j = 0; j < i; j++) {
+            auto maxIou = iouMax[j];
+            auto iou = iouMatrix[i * (i - 1) / 2 + j];
+            auto decay = m_decay_fn(iou, maxIou, m_gaussianSigma);
+            minDecay = std::min(minDecay, decay);
+        }
+        decayedScores[i] = minDecay * scoresData[candidateIndex[i]];
+    });
+
     if (scoresData[candidateIndex[0]] > m_postThreshold) {
         auto box_index = candidateIndex[0];
         auto box = boxesData + box_index * 4;
@@ -223,14 +233,7 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
     }
 
     for (int64_t i = 1; i < originalSize; i++) {
-        float minDecay = 1.;
-        for (int64_t j = 0; j < i; j++) {
-            auto maxIou = iouMax[j];
-            auto iou = iouMatrix[i * (i - 1) / 2 + j];
-            auto decay = m_decay_fn(iou, maxIou, m_gaussianSigma);
-            minDecay = std::min(minDecay, decay);
-        }
-        auto ds = minDecay * scoresData[candidateIndex[i]];
+        auto ds = decayedScores[i];
         if (ds <= m_postThreshold)
             continue;
         auto boxIndex = candidateIndex[i];
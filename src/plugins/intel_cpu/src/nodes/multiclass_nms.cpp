@@ -17,6 +17,7 @@
 
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "common/box_utils.h"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
@@ -390,28 +391,9 @@ bool MultiClassNms::created() const {
     return getType() == Type::MulticlassNms;
 }
 
-float MultiClassNms::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+// the coordinates may come in both {x0, y0, x1, y1} and {y0, x0, y1, x1} orders, IoU does not depend on it
+static inline float boxArea(const float* box, const float norm) {
+    return (box[2] - box[0] + norm) * (box[3] - box[1] + norm);
 }
 
 void MultiClassNms::nmsWithEta(const float* boxes,
@@ -424,10 +406,7 @@ void MultiClassNms::nmsWithEta(const float* boxes,
     auto less = [](const boxInfo& l, const boxInfo& r) {
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
     };
-
-    auto func = [](float iou, float adaptive_threshold) {
-        return iou <= adaptive_threshold ? 1.0f : 0.0f;
-    };
+    const float norm = static_cast<float>(m_normalized == false);
 
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (!shared) {
@@ -441,47 +420,42 @@ void MultiClassNms::nmsWithEta(const float* boxes,
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
+            std::vector<boxInfo> candidates;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
             for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
                 if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                    candidates.push_back(boxInfo({scoresPtr[box_idx], box_idx}));
             }
+            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less, std::move(candidates));
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
                 auto adaptive_threshold = m_iouThreshold;
                 int max_out_box =
                     (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                BoxesSoA keptBoxes;
+                keptBoxes.reserve(max_out_box);
                 while (max_out_box && !sorted_boxes.empty()) {
                     boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
                     sorted_boxes.pop();
                     max_out_box--;
 
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= m_scoreThreshold)
-                            break;
-                    }
+                    // The score of a box is decayed by the reference only together with its suppression, so the selected
+                    // boxes keep their scores and are never re-queued. The reference checks the selected boxes from the
+                    // last one and stops after the first check when the score is not above the threshold.
+                    const float* box = &boxesPtr[currBox.idx * 4];
+                    const float area = boxArea(box, norm);
+                    size_t first = 0;
+                    if (currBox.score <= m_scoreThreshold && keptBoxes.size() > 0)
+                        first = keptBoxes.size() - 1;
+                    const bool box_is_selected = !keptBoxes.any_iou(box, area, norm, iou_mode::multiclass_nms,
+                        [adaptive_threshold](float iou) { return iou >= adaptive_threshold; }, first);
 
-                    currBox.suppress_begin_index = fb.size();
                     if (box_is_selected) {
                         if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
                             adaptive_threshold *= m_nmsEta;
                         }
-                        if (currBox.score == origScore) {
-                            fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
-                            continue;
-                        }
-                        if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
-                        }
+                        fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
+                        keptBoxes.push_back(box, area);
                     }
                 }
             }
@@ -533,6 +507,11 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
                                 const SizeVector& scoresStrides,
                                 const SizeVector& roisnumStrides,
                                 const bool shared) {
+    const float norm = static_cast<float>(m_normalized == false);
+    const auto suppresses = [this](float iou) {
+        return iou >= m_iouThreshold;
+    };
+
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         /*
         // nms over a class over an image
@@ -558,29 +537,24 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                int max_out_box =
+                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                // only max_out_box best candidates are checked, so there is no need to sort all of them
+                select_top_k(sorted_boxes.data(), sorted_boxes.size(), max_out_box,
+                             [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                 });
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
+                BoxesSoA keptBoxes;
+                keptBoxes.reserve(max_out_box);
+                for (int box_idx = 0; box_idx < max_out_box; box_idx++) {
+                    const float* box = &boxesPtr[sorted_boxes[box_idx].second * 4];
+                    const float area = boxArea(box, norm);
+                    if (!keptBoxes.any_iou(box, area, norm, iou_mode::multiclass_nms, suppresses)) {
                         m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
                             sorted_boxes[box_idx].second);
                         io_selection_size++;
+                        keptBoxes.push_back(box, area);
                     }
                 }
             }
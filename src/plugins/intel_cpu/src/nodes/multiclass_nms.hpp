@@ -86,7 +86,6 @@ private:
     struct boxInfo {
         float score;
         int idx;
-        int suppress_begin_index;
     };
 
     std::vector<filteredBoxes> m_filtBoxes; // rois after nms for each class in each image
@@ -94,8 +93,6 @@ private:
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
-    float intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized);
-
     void nmsWithEta(const float* boxes, const float* scores, const int* roisnum, const InferenceEngine::SizeVector& boxesStrides,
                     const InferenceEngine::SizeVector& scoresStrides, const InferenceEngine::SizeVector& roisnumStrides, const bool shared);
 
@@ -8,6 +8,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include "ie_parallel.hpp"
 #include "reverse_sequence.h"
+#include <utils/general_utils.h>
 
 using namespace InferenceEngine;
 
@@ -70,13 +71,22 @@ void ReverseSequence::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    // the data is only moved, so any precision of the supported size is kept (e.g. bf16 activations aren't converted)
+    Precision dataPrecision = getOriginalInputPrecisionAtPort(REVERSESEQUENCE_DATA);
+    if (!one_of(dataPrecision.size(),
+                sizeof(PrecisionTrait<Precision::I64>::value_type),
+                sizeof(PrecisionTrait<Precision::I32>::value_type),
+                sizeof(PrecisionTrait<Precision::I16>::value_type),
+                sizeof(PrecisionTrait<Precision::I8>::value_type)))
+        dataPrecision = Precision::FP32;
+
     lengthsPrecision = getOriginalInputPrecisionAtPort(REVERSESEQUENCE_LENGTHS);
     if (lengthsPrecision != Precision::I32 && lengthsPrecision != Precision::FP32)
         lengthsPrecision = Precision::I32;
 
-    addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32},
+    addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                           {LayoutType::ncsp, lengthsPrecision}},
-                         {{LayoutType::ncsp, Precision::FP32}},
+                         {{LayoutType::ncsp, dataPrecision}},
                          impl_desc_type::ref_any);
 }
 
@@ -126,12 +136,12 @@ ReverseSequence::ReverseSequenceExecutor::ReverseSequenceExecutor(const VectorDi
     workAmountDst = srcStrides[0] * dataDims[0];
 }
 
-template<typename T>
+template<typename TData, typename TLengths>
 void ReverseSequence::ReverseSequenceExecutor::exec(const MemoryPtr& dataMemPtr, const MemoryPtr& seqLengthsMemPtr, const MemoryPtr& dstMemPtr) {
     const VectorDims& srcDims = dataMemPtr->getStaticDims();
-    const auto *srcData = reinterpret_cast<const float *>(dataMemPtr->getData());
-    auto *dstData = reinterpret_cast<float *>(dstMemPtr->getData());
-    auto *seqLengthsData = reinterpret_cast<T *>(seqLengthsMemPtr->getData());
+    const auto *srcData = reinterpret_cast<const TData *>(dataMemPtr->getData());
+    auto *dstData = reinterpret_cast<TData *>(dstMemPtr->getData());
+    auto *seqLengthsData = reinterpret_cast<TLengths *>(seqLengthsMemPtr->getData());
 
     for (size_t i = 0; i < srcDims[batchAxis]; ++i) {
         if (static_cast<int32_t>(seqLengthsData[i]) > static_cast<int>(srcDims[seqAxis])) {
@@ -166,6 +176,18 @@ void ReverseSequence::ReverseSequenceExecutor::exec(const MemoryPtr& dataMemPtr,
     });
 }
 
+template<typename TData>
+void ReverseSequence::executeWithData(const Precision& lengthsPrecision) {
+    if (lengthsPrecision == Precision::FP32)
+        execPtr->exec<TData, float>(getParentEdgeAt(REVERSESEQUENCE_DATA)->getMemoryPtr(),
+                                    getParentEdgeAt(REVERSESEQUENCE_LENGTHS)->getMemoryPtr(),
+                                    getChildEdgeAt(0)->getMemoryPtr());
+    else
+        execPtr->exec<TData, int32_t>(getParentEdgeAt(REVERSESEQUENCE_DATA)->getMemoryPtr(),
+                                      getParentEdgeAt(REVERSESEQUENCE_LENGTHS)->getMemoryPtr(),
+                                      getChildEdgeAt(0)->getMemoryPtr());
+}
+
 void ReverseSequence::execute(dnnl::stream strm) {
     if (!execPtr)
         IE_THROW() << errorPrefix << " has no compiled executor";
@@ -174,14 +196,23 @@ void ReverseSequence::execute(dnnl::stream strm) {
     if (!one_of(precision, Precision::FP32, Precision::I32))
         IE_THROW() << "ReverseSequence layer does not support " << precision  << " precision";
 
-    if (precision == Precision::FP32)
-        execPtr->exec<float>(getParentEdgeAt(REVERSESEQUENCE_DATA)->getMemoryPtr(),
-                             getParentEdgeAt(REVERSESEQUENCE_LENGTHS)->getMemoryPtr(),
-                             getChildEdgeAt(0)->getMemoryPtr());
-    else
-        execPtr->exec<int32_t>(getParentEdgeAt(REVERSESEQUENCE_DATA)->getMemoryPtr(),
-                               getParentEdgeAt(REVERSESEQUENCE_LENGTHS)->getMemoryPtr(),
-                               getChildEdgeAt(0)->getMemoryPtr());
+    const auto dataPrecision = getParentEdgeAt(REVERSESEQUENCE_DATA)->getMemory().getDesc().getPrecision();
+    switch (dataPrecision.size()) {
+        case sizeof(PrecisionTrait<Precision::I8>::value_type):
+            executeWithData<PrecisionTrait<Precision::I8>::value_type>(precision);
+            break;
+        case sizeof(PrecisionTrait<Precision::I16>::value_type):
+            executeWithData<PrecisionTrait<Precision::I16>::value_type>(precision);
+            break;
+        case sizeof(PrecisionTrait<Precision::I32>::value_type):
+            executeWithData<PrecisionTrait<Precision::I32>::value_type>(precision);
+            break;
+        case sizeof(PrecisionTrait<Precision::I64>::value_type):
+            executeWithData<PrecisionTrait<Precision::I64>::value_type>(precision);
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported 'data' input precision: " << dataPrecision.name();
+    }
 }
 
 bool ReverseSequence::created() const {
@@ -33,7 +33,7 @@ private:
                                 int batchAxis, int seqAxis);
         ~ReverseSequenceExecutor() = default;
 
-        template<typename T>
+        template<typename TData, typename TLengths>
         void exec(const MemoryPtr& dataMemPtr, const MemoryPtr& seqLengthsMemPtr, const MemoryPtr& dstMemPtr);
 
     private:
@@ -43,6 +43,9 @@ private:
         size_t workAmountDst;
     };
 
+    template<typename TData>
+    void executeWithData(const InferenceEngine::Precision& lengthsPrecision);
+
     using ExecutorPtr = std::shared_ptr<ReverseSequenceExecutor>;
     ExecutorPtr execPtr = nullptr;
 
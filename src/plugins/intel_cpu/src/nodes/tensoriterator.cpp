@@ -72,6 +72,43 @@ static std::vector<MemoryPtr> getToMemories(const Node* node, const size_t port)
     return memories;
 }
 
+// checks whether the memory of the body input node may be redirected to the external memory
+static bool canBeBoundInPlace(const NodePtr& inNode) {
+    for (auto& edge : inNode->getChildEdges()) {
+        auto childEdge = edge.lock();
+        if (!childEdge)
+            return false;
+
+        auto child = childEdge->getChild();
+        if (child->isConstant() || childEdge->inPlace(Edge::LOOK_DOWN) || childEdge->modifiedInPlace() ||
+            (child->getType() == Type::Concatenation && child->isInPlace()))
+            return false;
+    }
+    return true;
+}
+
+// checks whether the memory of the body output node may be redirected to the external memory
+static bool canBeBoundInPlace(const EdgePtr& outEdge) {
+    auto parent = outEdge->getParent();
+    const void* defaultPtr = outEdge->getMemory().getData();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace() ||
+            parent->getType() == Type::Input)
+            return false;
+
+        for (auto& edge : parent->getParentEdges()) {
+            auto parentEdge = edge.lock();
+            if (parentEdge && parentEdge->getMemory().getData() == defaultPtr) {
+                parent = parentEdge->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 static void nullifyUndefinedDims(VectorDims& dims) {
     std::transform(dims.begin(), dims.end(), dims.begin(), [](const size_t& dim) {
         return dim == Shape::UNDEFINED_DIM ? 0 : dim;
@@ -145,6 +182,117 @@ private:
     int iter_count;
 };
 
+/**
+ * Zero-copy counterpart of PortIteratorHelper and BackEdgePortHelper.
+ * Instead of copying the data, the body memory is redirected to the corresponding chunk of the external tensor.
+ * It is only possible when the chunk is a dense block of the external tensor, i.e. both tensors have the same
+ * precision and plain layout, and all the dimensions before the iteration axis are equal to 1.
+ * For not sliced port (axis == -1) the whole external tensor is used.
+ */
+class PortInPlaceHelper : public PortMapHelper {
+public:
+    PortInPlaceHelper(const MemoryPtr &full, const std::vector<MemoryPtr> &parts, const PortMap &slice_rule)
+                      : full_mem(full), part_mems(parts) {
+        const auto& full_dims = full_mem->getStaticDims();
+        const auto axis = slice_rule.axis;
+
+        if (axis == -1) {
+            iter_count = 1;
+            chunk_size_in_byte = full_mem->getSize();
+            return;
+        }
+
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = full_dims[axis] / abs_stride;
+        chunk_size_in_byte = full_dims[axis] ? full_mem->getSize() / full_dims[axis] * abs_stride : 0;
+
+        chunk_stride_in_byte = chunk_size_in_byte;
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        if (iter < 0)
+            iter = 0;
+        IE_ASSERT(iter < iter_count);
+
+        auto data = static_cast<uint8_t *>(full_mem->getData()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (const auto& part_mem : part_mems) {
+            auto memMngr = part_mem->getMemoryMngr();
+            IE_ASSERT(memMngr);
+            if (memMngr->getRawPtr() != data)
+                memMngr->setExtBuff(data, chunk_size_in_byte);
+        }
+    }
+
+    static bool isApplicable(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule) {
+        const auto& full_desc = full->getDesc();
+        const auto& part_desc = part->getDesc();
+        if (!full_desc.isDefined() || !part_desc.isDefined() ||
+            full_desc.getPrecision() != part_desc.getPrecision() ||
+            !full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp))
+            return false;
+
+        if (slice_rule.axis == -1)
+            return full->getStaticDims() == part->getStaticDims();
+
+        const auto& full_dims = full->getStaticDims();
+        const auto abs_stride = static_cast<size_t>(std::abs(slice_rule.stride));
+        if (full_dims[slice_rule.axis] == 0 || full_dims[slice_rule.axis] % abs_stride != 0 ||
+            full->getSize() / full_dims[slice_rule.axis] * abs_stride != part->getSize())
+            return false;
+        return std::all_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim == 1; });
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0;
+
+    MemoryPtr full_mem;
+    std::vector<MemoryPtr> part_mems;
+
+    int iter_count = 1;
+};
+
+/**
+ * Back edge helper for the dynamic shapes. In contrast to BackEdgePortHelper it doesn't capture the oneDNN memory objects,
+ * since the body memory descriptors may be redefined on each iteration. The body inputs are redefined and the reorder
+ * is recreated only when the descriptor of the body output has been changed since the previous iteration, so the helper
+ * may be reused while the shapes of the back edge stay the same.
+ */
+class DynamicBackEdgePortHelper : public PortMapHelper {
+public:
+    DynamicBackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const std::vector<MemoryPtr> &to)
+                              : cache(cache), from_mem(from), to_mems(to) {}
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter == 0)
+            return;
+
+        // the body output memory gets a new descriptor only when its shape is changed
+        const auto from_desc = from_mem->getDescPtr();
+        if (from_desc != last_from_desc) {
+            redefineToMemories(to_mems, from_desc);
+            last_from_desc = from_desc;
+            reorder = {};
+        }
+
+        // first memory is enough to get common memory ptr
+        mem_holder_src = from_mem->getPrimitive();
+        mem_holder_dst = to_mems.front()->getPrimitive();
+        if (!reorder)
+            reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+    }
+
+private:
+    MultiCachePtr cache;
+    MemoryPtr from_mem;
+    std::vector<MemoryPtr> to_mems;
+    MemoryDescPtr last_from_desc;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -415,6 +563,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_in_place.push_back(canBeBoundInPlace(inNode->second));
         }
     }
 
@@ -424,8 +573,9 @@ void TensorIterator::getSupportedDescriptors() {
         const auto inputID = ov::op::util::create_ie_output_name(prev);
         auto outNode = outMap.find(inputID);
         if (outNode != outMap.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            output_mem.push_back(outMem);
+            auto outEdge = outNode->second->getParentEdgeAt(0);
+            output_mem.push_back(outEdge->getMemoryPtr());
+            output_in_place.push_back(canBeBoundInPlace(outEdge));
         }
     }
 
@@ -480,6 +630,13 @@ void TensorIterator::getSupportedDescriptors() {
         }
     }
 
+    // the back edges overwrite the body inputs on each iteration, so such inputs can't share the external memory,
+    // and the back edge sources must keep the previous iteration results until they are copied
+    for (const auto& map_rule : backEdges) {
+        input_in_place[map_rule.to] = false;
+        output_in_place[map_rule.from] = false;
+    }
+
     if (auto loopOp = ov::as_type_ptr<const ov::op::v5::Loop>(ngraphOp)) {
         algorithm = Algorithm::TensorIteratorLoop;
         auto spec_port = loopOp->get_special_body_ports();
@@ -546,7 +703,9 @@ void TensorIterator::prepareParams() {
     prepareInitialCond();
 
     first_mappers.clear();
+    last_mappers.clear();
     before_mappers.clear();
+    after_mappers.clear();
     back_mappers.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
@@ -559,6 +718,8 @@ void TensorIterator::prepareParams() {
         if (!isDynamicNode()) {
             prepareOutputPorts();
             prepareBackEdges();
+        } else {
+            prepareDynamicBackEdges();
         }
 
         // reset local states of DynamicBuffer
@@ -620,10 +781,6 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
 
         for (auto& buffer : buffers)
             buffer->execute(eng, i);
-
-        // on the last iteration we shouldn't reshape body inputs and init back edges
-        if ((i + 1 != max_num_iter) && continue_cond)
-            prepareDynamicBackEdges();
     }
 
     reshapeAndFillOutput(strm);
@@ -635,7 +792,22 @@ void TensorIterator::prepareInputPorts() {
     const auto &eng = getEngine();
     for (auto map_rule : inputPortMap) {
         auto from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
+        auto &to_mems = input_mems[map_rule.to];
+        auto &to_mem = to_mems.front();  // first memory is enough to access the shared underlying physical memory
+
+        if (input_in_place[map_rule.to] && PortInPlaceHelper::isApplicable(from_mem, to_mem, map_rule)) {
+            auto mapper = std::make_shared<PortInPlaceHelper>(from_mem, to_mems, map_rule);
+            if (map_rule.axis == -1)
+                first_mappers.emplace_back(mapper);
+            else
+                before_mappers.emplace_back(mapper);
+            bound_inputs.insert(map_rule.to);
+            continue;
+        }
+
+        // the body memory must not refer to the external memory anymore
+        if (bound_inputs.erase(map_rule.to))
+            detachFromExternalMemory(to_mems);
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
@@ -647,10 +819,24 @@ void TensorIterator::prepareInputPorts() {
 
 void TensorIterator::prepareOutputPorts() {
     const auto &eng = getEngine();
+
+    // the outputs are bound again below, the body memory must not refer to the previous external memory
+    for (auto idx : bound_outputs)
+        detachFromExternalMemory({output_mem[idx]});
+    bound_outputs.clear();
+
     for (auto map_rule : outputPortMap) {
         auto to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
+        // the body writes concatenated outputs directly to the external memory
+        if (map_rule.axis != -1 && output_in_place[map_rule.to] && !bound_outputs.count(map_rule.to) &&
+            PortInPlaceHelper::isApplicable(to_mem, from_mem, map_rule)) {
+            before_mappers.emplace_back(std::make_shared<PortInPlaceHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
+            bound_outputs.insert(map_rule.to);
+            continue;
+        }
+
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
         else
@@ -669,16 +855,22 @@ void TensorIterator::prepareBackEdges() {
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
-    const auto &eng = getEngine();
-    back_mappers.clear();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mems = input_mems[map_rule.to];
 
-        redefineToMemories(to_mems, from_mem->getDescPtr());
+        // the helper redefines the body inputs only when the shape of the back edge has been changed
+        back_mappers.emplace_back(std::make_shared<DynamicBackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems));
+    }
+}
 
-        // first memory is enough to get common memory ptr
-        back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front(), eng));
+void TensorIterator::detachFromExternalMemory(const std::vector<MemoryPtr>& mems) {
+    for (const auto& mem : mems) {
+        auto memMngr = mem->getMemoryMngr();
+        if (memMngr && memMngr->hasExtBuffer()) {
+            memMngr->setExtBuff(nullptr, 0);
+            memMngr->resize(mem->getSize());
+        }
     }
 }
 
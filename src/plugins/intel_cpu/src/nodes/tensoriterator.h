@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <unordered_set>
 #include <common/memory_desc_wrapper.hpp>
 
 namespace ov {
@@ -138,18 +139,24 @@ private:
     void reshapeAndFillOutput(dnnl::stream strm);
     bool checkForInputAndBodyShapesInequality() const;
     int getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) const;
+    static void detachFromExternalMemory(const std::vector<MemoryPtr>& mems);
 
     ExtensionManager::Ptr ext_mng;
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
 
+    std::vector<bool> input_in_place;   /// < Body inputs which may refer to the external memory directly
+    std::vector<bool> output_in_place;  /// < Body outputs which may be written to the external memory directly
+    std::unordered_set<int> bound_inputs;   /// < Body inputs currently redirected to the external memory
+    std::unordered_set<int> bound_outputs;  /// < Body outputs currently redirected to the external memory
+
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
         last_mappers,    /// < Applied once after loop
         before_mappers,  /// < Applied before each iteration
         after_mappers,   /// < Applied after each iteration
-        back_mappers;    /// < Applied before each iteration for dynamic shapes
+        back_mappers;    /// < Applied before each iteration for dynamic shapes, reused while the back edge shapes are the same
 
     std::shared_ptr<PortChecker>
         trip_count_check,      /// < Perform check of trip count value. value >= -1
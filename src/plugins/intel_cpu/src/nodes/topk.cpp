@@ -14,10 +14,13 @@
 #include <ngraph/op/topk.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <algorithm>
+#include <cstring>
+#include <numeric>
 
 #include <cpu/x64/jit_generator.hpp>
 #include <cpu/x64/jit_uni_eltwise.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 
@@ -2004,6 +2007,10 @@ void TopK::prepareParams() {
         top_k = reinterpret_cast<int *>(getParentEdgeAt(TOPK_K)->getMemoryPtr()->getData())[0];
     }
 
+    radix_select = use_radix_select();
+    if (radix_select)
+        return;
+
     if (jit_mode) {
         if (!preset_params_done) {
             preset_params();
@@ -2079,7 +2086,8 @@ void TopK::createPrimitive() {
         updateLastInputDims();
     }
 
-    if (jit_mode) {
+    // the static shape processed by the radix select never calls the kernel
+    if (jit_mode && !(radix_select && !isDynamicNode())) {
         if (!preset_params_done) {
             preset_params();
             preset_params_done = true;
@@ -2145,7 +2153,9 @@ void TopK::execute(dnnl::stream strm) {
     uint8_t *dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->getData());
     uint8_t *dst_idx = reinterpret_cast<uint8_t *>(dstIndexesMemPtr->getData());
 
-    if (jit_mode) {
+    if (radix_select) {
+        topk_radix_select(src_data, dst_data, dst_idx);
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -2369,6 +2379,218 @@ void TopK::calc_dims_size(const VectorDims &layout_dims) {
     }
 }
 
+namespace {
+
+// Keys of the radix select: unsigned integers, which keep the order of the values. Zeros of both signs get the same
+// key, since they are equal for the comparison based algorithms as well.
+inline uint32_t radix_key(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (value == 0.f)
+        return 0x80000000u;
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+inline uint32_t radix_key(bfloat16_t value) {
+    return radix_key(static_cast<float>(value));
+}
+
+inline uint32_t radix_key(int32_t value) {
+    return static_cast<uint32_t>(value) ^ 0x80000000u;
+}
+
+inline uint32_t radix_key(int8_t value) {
+    return radix_key(static_cast<int32_t>(value));
+}
+
+inline uint32_t radix_key(uint8_t value) {
+    return value;
+}
+
+struct radix_item {
+    uint32_t key;
+    int32_t idx;
+};
+
+// the larger key goes first, the equal keys are ordered by index as the stable sorting requires
+inline bool radix_item_greater(const radix_item& a, const radix_item& b) {
+    return a.key > b.key || (a.key == b.key && a.idx < b.idx);
+}
+
+// Finds the digit of the k-th largest key in the histogram. Returns the number of the elements with the larger digits.
+inline size_t radix_threshold(const std::vector<size_t>& hist, const size_t k, size_t& digit) {
+    size_t above = 0;
+    digit = hist.size() - 1;
+    while (above + hist[digit] < k) {
+        above += hist[digit];
+        digit--;
+    }
+    return above;
+}
+
+// Selects top k elements of the contiguous row of n elements. The first pass builds the histogram of the high bits
+// of the keys over the whole row, so it is split between nthr threads, as well as the collection of the elements that
+// pass the threshold. The survivors are usually a small share of the row, so they are refined by the lower digits
+// sequentially, and only the last bucket is sorted.
+template <typename T>
+void radix_select_row(const T* src, T* dst, int32_t* dst_idx, const size_t n, const size_t k,
+                      const bool mode_max, const bool sort_index, const int nthr) {
+    constexpr uint32_t first_bits = 12;
+    constexpr uint32_t next_bits = 10;
+    constexpr size_t sort_threshold = 1024;
+    const uint32_t flip = mode_max ? 0u : ~0u;
+
+    std::vector<std::vector<size_t>> hist(nthr, std::vector<size_t>(1 << first_bits, 0));
+    auto build_hist = [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(n, nthr, ithr, start, end);
+        auto& h = hist[ithr];
+        for (size_t i = start; i < end; i++)
+            h[(radix_key(src[i]) ^ flip) >> (32 - first_bits)]++;
+    };
+    if (nthr > 1) {
+        parallel_nt(nthr, build_hist);
+        for (int ithr = 1; ithr < nthr; ithr++)
+            std::transform(hist[0].begin(), hist[0].end(), hist[ithr].begin(), hist[0].begin(), std::plus<size_t>());
+    } else {
+        build_hist(0, 1);
+    }
+
+    size_t digit = 0;
+    size_t need = k - radix_threshold(hist[0], k, digit);
+
+    // the elements are collected in the index order, so the threads' parts are concatenated in the order of the chunks
+    std::vector<std::vector<radix_item>> selected_parts(nthr), candidate_parts(nthr);
+    auto collect = [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(n, nthr, ithr, start, end);
+        for (size_t i = start; i < end; i++) {
+            const uint32_t key = radix_key(src[i]) ^ flip;
+            const size_t d = key >> (32 - first_bits);
+            if (d > digit)
+                selected_parts[ithr].push_back({key, static_cast<int32_t>(i)});
+            else if (d == digit)
+                candidate_parts[ithr].push_back({key, static_cast<int32_t>(i)});
+        }
+    };
+    if (nthr > 1) {
+        parallel_nt(nthr, collect);
+    } else {
+        collect(0, 1);
+    }
+
+    std::vector<radix_item> selected;
+    selected.reserve(k);
+    std::vector<radix_item> candidates = std::move(candidate_parts[0]);
+    for (int ithr = 0; ithr < nthr; ithr++) {
+        selected.insert(selected.end(), selected_parts[ithr].begin(), selected_parts[ithr].end());
+        if (ithr > 0)
+            candidates.insert(candidates.end(), candidate_parts[ithr].begin(), candidate_parts[ithr].end());
+    }
+
+    uint32_t shift = 32 - first_bits;
+    std::vector<size_t> next_hist(1 << next_bits);
+    std::vector<radix_item> next_candidates;
+    while (candidates.size() > need && candidates.size() > sort_threshold && shift > 0) {
+        const uint32_t bits = std::min(shift, next_bits);
+        const uint32_t mask = (1u << bits) - 1;
+        shift -= bits;
+
+        next_hist.assign(static_cast<size_t>(mask) + 1, 0);
+        for (const auto& c : candidates)
+            next_hist[(c.key >> shift) & mask]++;
+        need -= radix_threshold(next_hist, need, digit);
+
+        next_candidates.clear();
+        for (const auto& c : candidates) {
+            const size_t d = (c.key >> shift) & mask;
+            if (d > digit)
+                selected.push_back(c);
+            else if (d == digit)
+                next_candidates.push_back(c);
+        }
+        std::swap(candidates, next_candidates);
+    }
+
+    // all the keys are equal once the digits are exhausted, so the first candidates have the smallest indices
+    if (candidates.size() > need && shift > 0)
+        std::nth_element(candidates.begin(), candidates.begin() + need - 1, candidates.end(), radix_item_greater);
+    selected.insert(selected.end(), candidates.begin(), candidates.begin() + need);
+
+    if (sort_index) {
+        std::sort(selected.begin(), selected.end(), [](const radix_item& a, const radix_item& b) {
+            return a.idx < b.idx;
+        });
+    } else {
+        std::sort(selected.begin(), selected.end(), radix_item_greater);
+    }
+    for (size_t i = 0; i < k; i++) {
+        dst[i] = src[selected[i].idx];
+        dst_idx[i] = selected[i].idx;
+    }
+}
+
+template <typename T>
+void radix_select(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr, const size_t rows,
+                  const size_t n, const size_t k, const bool mode_max, const bool sort_index) {
+    auto src = reinterpret_cast<const T*>(in_ptr);
+    auto dst = reinterpret_cast<T*>(out_ptr);
+    auto dst_idx = reinterpret_cast<int32_t*>(out_idx_ptr);
+
+    // beam search and sampling often come with a single row, then the row itself is split between the threads
+    constexpr size_t min_chunk = 4096;
+    const size_t max_threads = static_cast<size_t>(parallel_get_max_threads());
+    if (rows >= max_threads || n < 2 * min_chunk) {
+        parallel_for(rows, [&](size_t r) {
+            radix_select_row(src + r * n, dst + r * k, dst_idx + r * k, n, k, mode_max, sort_index, 1);
+        });
+    } else {
+        const int nthr = static_cast<int>(std::min(max_threads, n / min_chunk));
+        for (size_t r = 0; r < rows; r++)
+            radix_select_row(src + r * n, dst + r * k, dst_idx + r * k, n, k, mode_max, sort_index, nthr);
+    }
+}
+
+}  // namespace
+
+bool TopK::use_radix_select() const {
+    // The select is linear in the axis size, while the sorting networks and the heaps grow with top_k as well,
+    // so it pays off for the long axes, like the vocabulary logits, with top_k up to the hundreds.
+    constexpr size_t min_axis_dim = 4096;
+    constexpr size_t max_k_ratio = 16;
+    const size_t rank = src_dims.size();
+    const bool contiguous_row = (layout == TopKLayoutType::topk_ncsp && axis == static_cast<int>(rank - 1)) ||
+                                (layout == TopKLayoutType::topk_nspc && axis == 1 && rank > 1);
+    const size_t n = src_dims[axis];
+    return contiguous_row && top_k > 0 && n >= min_axis_dim && static_cast<size_t>(top_k) * max_k_ratio <= n;
+}
+
+void TopK::topk_radix_select(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    const size_t n = src_dims[axis];
+    const size_t k = static_cast<size_t>(top_k);
+    const size_t rows = std::accumulate(src_dims.begin(), src_dims.end(), size_t(1), std::multiplies<size_t>()) / n;
+    const auto precision = getParentEdgeAt(TOPK_DATA)->getMemoryPtr()->getDesc().getPrecision();
+    switch (precision) {
+    case Precision::FP32:
+        radix_select<float>(in_ptr, out_ptr, out_idx_ptr, rows, n, k, mode_max, sort_index);
+        break;
+    case Precision::BF16:
+        radix_select<bfloat16_t>(in_ptr, out_ptr, out_idx_ptr, rows, n, k, mode_max, sort_index);
+        break;
+    case Precision::I32:
+        radix_select<int32_t>(in_ptr, out_ptr, out_idx_ptr, rows, n, k, mode_max, sort_index);
+        break;
+    case Precision::I8:
+        radix_select<int8_t>(in_ptr, out_ptr, out_idx_ptr, rows, n, k, mode_max, sort_index);
+        break;
+    case Precision::U8:
+        radix_select<uint8_t>(in_ptr, out_ptr, out_idx_ptr, rows, n, k, mode_max, sort_index);
+        break;
+    default:
+        IE_THROW() << errorPrefix << " does not support radix select for precision " << precision.name();
+    }
+}
+
 void TopK::topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx) {
     if (mode_max)
         topk_ref_process(in_ptr, out_ptr, dst_idx, src_dims, [](float x, float y)->float { return x > y; });
@@ -101,6 +101,8 @@ public:
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
+    void topk_radix_select(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
+    bool use_radix_select() const;
     inline void topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *src_idx,
                                     uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount);
     inline static int count(const VectorDims& dims, size_t start_ind, size_t end_ind);
@@ -130,6 +132,7 @@ private:
     int dim = 0, before_num = 0;
     bool bubble_inplace = false;
     bool preset_params_done = false;
+    bool radix_select = false;  // long contiguous rows with relatively small top_k are processed by the radix select
 
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
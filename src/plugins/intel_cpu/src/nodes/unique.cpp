@@ -7,6 +7,8 @@
 #include "ie_parallel.hpp"
 #include <openvino/op/unique.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
@@ -63,7 +65,7 @@ Unique::Unique(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr con
 
 void Unique::initSupportedPrimitiveDescriptors() {
     dataPrecision = getOriginalInputPrecisionAtPort(IN_DATA);
-    if (dataPrecision != Precision::I32 && dataPrecision != Precision::I8 && dataPrecision != Precision::U8) {
+    if (!one_of(dataPrecision, Precision::I32, Precision::I8, Precision::U8, Precision::BF16, Precision::FP16)) {
         dataPrecision = Precision::FP32;
     }
     dataTypeSize = dataPrecision.size();
@@ -134,12 +136,16 @@ void Unique::execute(dnnl::stream strm) {
     if (flattened) {
         OV_SWITCH(intel_cpu, flattenExec, this, dataPrecision,
               OV_CASE(Precision::FP32, float),
+              OV_CASE(Precision::BF16, bfloat16_t),
+              OV_CASE(Precision::FP16, ov::float16),
               OV_CASE(Precision::I32, int32_t),
               OV_CASE(Precision::I8, int8_t),
               OV_CASE(Precision::U8, uint8_t))
     } else {
         OV_SWITCH(intel_cpu, slicedExec, this, dataPrecision,
               OV_CASE(Precision::FP32, float),
+              OV_CASE(Precision::BF16, bfloat16_t),
+              OV_CASE(Precision::FP16, ov::float16),
               OV_CASE(Precision::I32, int32_t),
               OV_CASE(Precision::I8, int8_t),
               OV_CASE(Precision::U8, uint8_t))
@@ -120,6 +120,8 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(gemm_acl);
     CASE(winograd_acl);
     CASE(gemm_mlas);
+    CASE(gemm_sparse);
+    CASE(gemm_dyn_quant);
 
 #undef CASE
     return "unknown";
@@ -41,6 +41,8 @@ enum impl_desc_type {
     sparse = 1<<25,
     //mlas backend
     mlas = 1<<26,
+    // int8 with the dynamic quantization of the input
+    dyn_quant = 1<<27,
 
     // real types
     ref_any             = ref  | any,
@@ -100,7 +102,9 @@ enum impl_desc_type {
     dw_acl             = _dw | acl,
     gemm_acl           = gemm | acl,
     winograd_acl       = winograd | acl,
-    gemm_mlas          = gemm | mlas
+    gemm_mlas          = gemm | mlas,
+    gemm_sparse        = gemm | sparse,
+    gemm_dyn_quant     = gemm | dyn_quant
 };
 
 const char * impl_type_to_string(impl_desc_type type);
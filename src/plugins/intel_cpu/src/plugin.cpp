@@ -12,6 +12,7 @@
 #include "extension_mngr.h"
 #include "extension.h"
 #include "serialize.h"
+#include "requests_coalescer.h"
 #include "threading/ie_executor_manager.hpp"
 
 #include "ie_icore.hpp"
@@ -20,14 +21,20 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/op/util/read_value_base.hpp"
 
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 #include "performance_heuristics.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "weights_cache.hpp"
 #include "utils/denormals.hpp"
+#include "cpp/ie_infer_request.hpp"
 
 #if defined(__linux__)
 # include <sys/auxv.h>
@@ -337,6 +344,109 @@ void Engine::CalculateStreams(Config& conf, const std::shared_ptr<ngraph::Functi
     }
 }
 
+static double MeasureThroughput(ExecNetwork& execNetwork, const int streams) {
+    // the tuning measures the steady state of the fully loaded streams, so the number of requests is twice the number
+    // of streams like in the benchmark app and the time of the first (warm-up) round is not accounted
+    static const auto measurementTime = std::chrono::milliseconds(200);
+    const size_t requestsNum = 2 * std::max(1, streams);
+
+    std::vector<IInferRequestInternal::Ptr> requests;
+    for (size_t i = 0; i < requestsNum; i++) {
+        auto request = execNetwork.CreateInferRequest();
+        for (const auto& input : execNetwork.GetInputsInfo()) {
+            auto blob = as<MemoryBlob>(request->GetBlob(input.first));
+            if (blob)
+                std::memset(blob->wmap().as<uint8_t*>(), 0, blob->byteSize());
+        }
+        requests.push_back(request);
+    }
+
+    auto inferRound = [&requests] {
+        for (auto& request : requests)
+            request->StartAsync();
+        for (auto& request : requests)
+            request->Wait(InferenceEngine::InferRequest::RESULT_READY);
+    };
+
+    inferRound();
+    size_t inferencesNum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration elapsed;
+    do {
+        inferRound();
+        inferencesNum += requestsNum;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < measurementTime);
+
+    return inferencesNum / std::chrono::duration<double>(elapsed).count();
+}
+
+std::shared_ptr<ExecNetwork> Engine::TuneStreams(const Config& conf,
+                                                 const InferenceEngine::IStreamsExecutor::Config& initialStreamsConfig,
+                                                 const InferenceEngine::CNNNetwork& network,
+                                                 const InferenceEngine::CNNNetwork& clonedNetwork) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::TuneStreams");
+    const auto function = clonedNetwork.getFunction();
+
+    // the candidates differ in the number of threads per stream the streams calculation starts from, the first one is
+    // the result of the heuristic, so it wins in case the measurements are equal
+    std::vector<Config> candidates;
+    const int cores = getNumberOfCPUCores();
+    for (const int preferThreads : {conf.modelPreferThreads, 1, 2, 4, 8, 16}) {
+        if (preferThreads > cores)
+            continue;
+        Config candidate = conf;
+        candidate.streamExecutorConfig = initialStreamsConfig;
+        candidate.modelPreferThreads = preferThreads;
+        GetPerformanceStreams(candidate, function);
+        const auto& executorConfig = candidate.streamExecutorConfig;
+        const bool duplicate = std::any_of(candidates.begin(), candidates.end(), [&](const Config& other) {
+            return other.streamExecutorConfig._streams == executorConfig._streams &&
+                   other.streamExecutorConfig._threadsPerStream == executorConfig._threadsPerStream;
+        });
+        if (!duplicate)
+            candidates.push_back(candidate);
+    }
+
+    // the candidates are not tried anymore once the time limit is exceeded, so the tuning takes at most the limit plus
+    // the compilation and the measurement of one candidate
+    static const auto tuningTimeLimit = std::chrono::seconds(2);
+    const auto tuningStart = std::chrono::steady_clock::now();
+
+    std::shared_ptr<ExecNetwork> bestNetwork;
+    double bestThroughput = 0.0;
+    int bestPreferThreads = conf.modelPreferThreads;
+    for (const auto& candidate : candidates) {
+        if (bestNetwork && std::chrono::steady_clock::now() - tuningStart > tuningTimeLimit) {
+            DEBUG_LOG("Streams tuning: the time limit is exceeded, the rest of the candidates are skipped");
+            break;
+        }
+        auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, candidate, extensionManager, shared_from_this());
+        if (candidates.size() == 1)
+            return execNetwork;
+
+        execNetwork->setNetworkInputs(clonedNetwork.getInputsInfo());
+        execNetwork->setNetworkOutputs(clonedNetwork.getOutputsInfo());
+        SetExeNetworkInfo(execNetwork, network.getFunction());
+
+        const auto throughput = MeasureThroughput(*execNetwork, candidate.streamExecutorConfig._streams);
+        DEBUG_LOG("Streams tuning: ", candidate.streamExecutorConfig._streams, " streams x ",
+                  candidate.streamExecutorConfig._threadsPerStream, " threads: ", throughput, " FPS");
+        if (!bestNetwork || throughput > bestThroughput) {
+            bestNetwork = execNetwork;
+            bestThroughput = throughput;
+            bestPreferThreads = candidate.modelPreferThreads;
+        }
+    }
+
+    // the tuned value replaces the heuristic one in the model rt_info, so the cached model is imported already tuned
+    ov::AnyMap hints_props;
+    hints_props.insert({std::string("MODEL_PREFER_THREADS"), std::to_string(bestPreferThreads)});
+    function->set_rt_info(hints_props, "intel_cpu_hints_config");
+
+    return bestNetwork;
+}
+
 StreamCfg Engine::GetNumStreams(InferenceEngine::IStreamsExecutor::ThreadBindingType thread_binding_type,
                                         int stream_mode,
                                         const bool enable_hyper_thread) const {
@@ -461,6 +571,81 @@ static Config::SnippetsMode getSnippetsMode(const std::map<std::string, std::str
         IE_THROW() << "Wrong value for property key SNIPPETS_MODE. Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
 }
 
+// the shape buckets the static model is relaxed for, see ov::intel_cpu::relax_static_inputs
+static std::vector<std::map<std::string, std::vector<size_t>>> getRelaxedShapeBuckets(const std::map<std::string, std::string>& modelConfig,
+                                                                                      const Config& engineConfig,
+                                                                                      Config::ModelType modelType) {
+    Config tempConf = engineConfig;
+    tempConf.readProperties(modelConfig, modelType);
+    if (!tempConf.relaxStaticInputs)
+        return {};
+    return tempConf.shapeBuckets;
+}
+
+static size_t getMaxCoalescedRequests(const std::map<std::string, std::string>& modelConfig,
+                                      const Config& engineConfig,
+                                      Config::ModelType modelType) {
+    Config tempConf = engineConfig;
+    tempConf.readProperties(modelConfig, modelType);
+    return tempConf.maxCoalescedRequests;
+}
+
+static void setStaticInputShapes(const std::shared_ptr<ov::Model>& model, const std::map<std::string, std::vector<size_t>>& inputDims) {
+    for (const auto& param : model->get_parameters()) {
+        const auto dims = inputDims.find(param->get_friendly_name());
+        if (dims != inputDims.end())
+            param->set_partial_shape(ov::Shape(dims->second));
+    }
+    model->validate_nodes_and_infer_types();
+}
+
+/* The static model compiled with the shape buckets and ov::intel_cpu::relax_static_inputs is served at the shapes of
+ * the buckets without the recompilation: the input dimensions the buckets differ in are relaxed before the
+ * transformations, so the transformed model and the packed weights are shared by the static graphs compiled for the
+ * buckets. Returns the original input shapes of the relaxed inputs (empty if the model is kept static).
+ */
+static std::map<std::string, std::vector<size_t>> relaxBucketedInputs(const std::shared_ptr<ov::Model>& model,
+                                                                      const std::vector<std::map<std::string, std::vector<size_t>>>& buckets) {
+    std::map<std::string, std::vector<size_t>> modelBucket;
+    if (buckets.empty() || model->is_dynamic() || op::util::has_op_with_type<op::util::ReadValueBase>(model))
+        return modelBucket;
+
+    for (const auto& param : model->get_parameters()) {
+        const auto& name = param->get_friendly_name();
+        const auto& tensorNames = param->get_output_tensor(0).get_names();
+        const auto shape = param->get_output_shape(0);
+        ov::PartialShape relaxedShape(shape);
+        for (const auto& bucket : buckets) {
+            const auto dims = std::find_if(bucket.begin(), bucket.end(),
+                                           [&](const std::pair<const std::string, std::vector<size_t>>& item) {
+                                               return item.first == name || tensorNames.count(item.first);
+                                           });
+            // the incompatible bucket is reported when the buckets are compiled
+            if (dims == bucket.end() || dims->second.size() != shape.size())
+                continue;
+            for (size_t i = 0; i < shape.size(); i++) {
+                if (dims->second[i] != shape[i])
+                    relaxedShape[i] = Dimension::dynamic();
+            }
+        }
+        if (relaxedShape.is_dynamic()) {
+            param->set_partial_shape(relaxedShape);
+            modelBucket[name] = shape;
+        }
+    }
+    if (modelBucket.empty())
+        return modelBucket;
+
+    try {
+        model->validate_nodes_and_infer_types();
+    } catch (const ov::Exception&) {
+        // the shapes are fixed by the model (e.g. by the constant target shape of Reshape), keep it static
+        setStaticInputShapes(model, modelBucket);
+        modelBucket.clear();
+    }
+    return modelBucket;
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::LoadExeNetworkImpl");
@@ -495,7 +680,21 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     auto nGraphFunc = clonedNetwork.getFunction();
     Config::ModelType modelType = getModelType(nGraphFunc);
     ov::element::Type inferencePrecision = getInferencePrecision(config, engConfig, modelType);
-    const Config::SnippetsMode snippetsMode = getSnippetsMode(config, engConfig); 
+    const Config::SnippetsMode snippetsMode = getSnippetsMode(config, engConfig);
+    // the rows of the batch may be mixed by the transformed model (e.g. by the fused shape computations), so the
+    // batch independence required by the requests coalescing is checked on the original one
+    if (getMaxCoalescedRequests(config, engConfig, modelType) > 1)
+        RequestsCoalescer::CheckBatchIndependence(nGraphFunc);
+    // dynamic outputs are not supported by the legacy API, so the legacy model stays static
+    const auto modelBucket = isLegacyAPI() ? std::map<std::string, std::vector<size_t>>{}
+                                           : relaxBucketedInputs(nGraphFunc, getRelaxedShapeBuckets(config, engConfig, modelType));
+    // the relaxed model loses the optimizations of the static shapes (e.g. the snippets and the folded shape
+    // computations), so the original input shapes are inferred by the model transformed with these shapes
+    CNNNetwork staticNetwork;
+    if (!modelBucket.empty()) {
+        staticNetwork = InferenceEngine::details::cloneNetwork(clonedNetwork);
+        setStaticInputShapes(staticNetwork.getFunction(), modelBucket);
+    }
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
@@ -511,6 +710,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     Config conf = engConfig;
 
     conf.readProperties(config, modelType);
+    const auto initialStreamsConfig = conf.streamExecutorConfig;
     CalculateStreams(conf, nGraphFunc);
 
     transformations.PostLpt();
@@ -542,7 +742,22 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    // the streams of the shared pool are defined by the first model, so there is nothing to tune for the others
+    if (conf.streamsAutoTuning && !conf.sharedStreamsPool && is_cpu_map_available() && !nGraphFunc->is_dynamic() &&
+        !conf.streamExecutorConfig._streams_changed && conf.perfHintsConfig.ovPerfHint == CONFIG_VALUE(THROUGHPUT)) {
+        return TuneStreams(conf, initialStreamsConfig, network, clonedNetwork);
+    }
+
+    if (staticNetwork.getFunction()) {
+        Transformations staticTransformations(staticNetwork.getFunction(), enableLPT, inferencePrecision, isLegacyAPI(),
+                                              snippetsMode, engConfig);
+        staticTransformations.UpToLpt();
+        staticTransformations.PostLpt();
+        staticTransformations.Snippets();
+        staticTransformations.CpuSpecificOpSet();
+    }
+
+    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this(), staticNetwork);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -711,6 +926,15 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::device::id.name()),
                                                     RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                     RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                    RW_property(ov::intel_cpu::shape_buckets.name()),
+                                                    RW_property(ov::intel_cpu::max_coalesced_requests.name()),
+                                                    RW_property(ov::intel_cpu::streams_auto_tuning.name()),
+                                                    RW_property(ov::intel_cpu::shared_streams_pool.name()),
+                                                    RW_property(ov::hint::model_priority.name()),
+                                                    RW_property(ov::intel_cpu::dynamic_quantization.name()),
+                                                    RW_property(ov::intel_cpu::weights_prefetch.name()),
+                                                    RW_property(ov::intel_cpu::refine_memory_formats.name()),
+                                                    RW_property(ov::intel_cpu::relax_static_inputs.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -753,6 +977,24 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::shape_buckets) {
+        return decltype(ov::intel_cpu::shape_buckets)::value_type(engConfig.shapeBucketsStr);
+    } else if (name == ov::intel_cpu::max_coalesced_requests) {
+        return decltype(ov::intel_cpu::max_coalesced_requests)::value_type(engConfig.maxCoalescedRequests);
+    } else if (name == ov::intel_cpu::streams_auto_tuning) {
+        return decltype(ov::intel_cpu::streams_auto_tuning)::value_type(engConfig.streamsAutoTuning);
+    } else if (name == ov::intel_cpu::shared_streams_pool) {
+        return decltype(ov::intel_cpu::shared_streams_pool)::value_type(engConfig.sharedStreamsPool);
+    } else if (name == ov::hint::model_priority) {
+        return decltype(ov::hint::model_priority)::value_type(engConfig.modelPriority);
+    } else if (name == ov::intel_cpu::dynamic_quantization) {
+        return decltype(ov::intel_cpu::dynamic_quantization)::value_type(engConfig.fcDynamicQuantization);
+    } else if (name == ov::intel_cpu::weights_prefetch) {
+        return decltype(ov::intel_cpu::weights_prefetch)::value_type(engConfig.weightsPrefetch);
+    } else if (name == ov::intel_cpu::refine_memory_formats) {
+        return decltype(ov::intel_cpu::refine_memory_formats)::value_type(engConfig.refineMemoryFormats);
+    } else if (name == ov::intel_cpu::relax_static_inputs) {
+        return decltype(ov::intel_cpu::relax_static_inputs)::value_type(engConfig.relaxStaticInputs);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
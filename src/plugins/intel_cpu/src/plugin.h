@@ -51,6 +51,11 @@ private:
 
     void CalculateStreams(Config& conf, const std::shared_ptr<ngraph::Function>& ngraphFunc, bool imported = false);
 
+    std::shared_ptr<ExecNetwork> TuneStreams(const Config& conf,
+                                             const InferenceEngine::IStreamsExecutor::Config& initialStreamsConfig,
+                                             const InferenceEngine::CNNNetwork& network,
+                                             const InferenceEngine::CNNNetwork& clonedNetwork);
+
     StreamCfg GetNumStreams(InferenceEngine::IStreamsExecutor::ThreadBindingType thread_binding_type,
                             int stream_mode,
                             const bool enable_hyper_thread = true) const;
@@ -0,0 +1,437 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "requests_coalescer.h"
+#include "infer_request.h"
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/util/pad_base.hpp>
+#include <openvino/op/util/reduction_base.hpp>
+#include <openvino/op/util/topk_base.hpp>
+
+#include <algorithm>
+#include <map>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// the batch the model is reshaped to by the batch independence check, any batch > 1 makes the batch axis traceable
+constexpr int64_t checkedBatch = 2;
+// the axis of the output which doesn't depend on the batched inputs
+constexpr int64_t noBatch = -1;
+// the runtime info of the batch independent model
+const char batchIndependentKey[] = "CPU_BATCH_INDEPENDENT";
+
+int64_t rankOf(const ov::PartialShape& shape) {
+    return shape.rank().get_length();
+}
+
+bool getConstValues(const std::shared_ptr<ov::Node>& node, size_t port, std::vector<int64_t>& values) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(port));
+    if (!constant)
+        return false;
+    values = constant->cast_vector<int64_t>();
+    return true;
+}
+
+bool containsAxis(const std::vector<int64_t>& axes, int64_t axis, int64_t rank) {
+    return std::any_of(axes.begin(), axes.end(), [&](int64_t item) {
+        return (item < 0 ? item + rank : item) == axis;
+    });
+}
+
+bool onlyDataIsBatched(const std::vector<int64_t>& inAxes) {
+    return inAxes[0] != noBatch && std::all_of(inAxes.begin() + 1, inAxes.end(), [](int64_t axis) {
+        return axis == noBatch;
+    });
+}
+
+// the numpy broadcasting elementwise operations: each output element depends only on the input elements with the same
+// index, so the batch independence requires only that the unbatched inputs don't vary along the batch axis
+bool isElementwise(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseComparison>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseLogical>(node) ||
+           ov::is_type<ov::op::v0::Convert>(node) || ov::is_type<ov::op::v1::LogicalNot>(node) ||
+           ov::is_type<ov::op::v4::Swish>(node) || ov::is_type<ov::op::v0::Selu>(node) ||
+           ov::is_type<ov::op::v0::PRelu>(node) || ov::is_type<ov::op::v0::FakeQuantize>(node) ||
+           ov::is_type<ov::op::v1::Select>(node);
+}
+
+// the operations computing each item of the outermost dimension of the data independently
+bool isPerBatchItem(const std::shared_ptr<ov::Node>& node) {
+    if (const auto maxPool = ov::as_type_ptr<ov::op::v8::MaxPool>(node)) {
+        // the indices are counted through the whole tensor including the batch
+        return maxPool->output(1).get_target_inputs().empty();
+    }
+    return ov::is_type<ov::op::v1::Convolution>(node) || ov::is_type<ov::op::v1::GroupConvolution>(node) ||
+           ov::is_type<ov::op::v1::ConvolutionBackpropData>(node) ||
+           ov::is_type<ov::op::v1::GroupConvolutionBackpropData>(node) ||
+           ov::is_type<ov::op::v1::BinaryConvolution>(node) || ov::is_type<ov::op::v1::MaxPool>(node) ||
+           ov::is_type<ov::op::v1::AvgPool>(node) || ov::is_type<ov::op::v0::BatchNormInference>(node) ||
+           ov::is_type<ov::op::v5::BatchNormInference>(node) || ov::is_type<ov::op::v0::MVN>(node) ||
+           ov::is_type<ov::op::v0::DepthToSpace>(node) || ov::is_type<ov::op::v0::SpaceToDepth>(node) ||
+           ov::is_type<ov::op::v0::Interpolate>(node) || ov::is_type<ov::op::v4::Interpolate>(node);
+}
+
+// the axes the operation reduces or normalizes the data over
+bool getReducedAxes(const std::shared_ptr<ov::Node>& node, std::vector<int64_t>& axes, bool& keepDims) {
+    keepDims = true;
+    if (const auto softmax = ov::as_type_ptr<ov::op::v1::Softmax>(node)) {
+        axes = {static_cast<int64_t>(softmax->get_axis())};
+    } else if (const auto softmax = ov::as_type_ptr<ov::op::v8::Softmax>(node)) {
+        axes = {softmax->get_axis()};
+    } else if (const auto logSoftmax = ov::as_type_ptr<ov::op::v5::LogSoftmax>(node)) {
+        axes = {logSoftmax->get_axis()};
+    } else if (const auto topK = ov::as_type_ptr<ov::op::util::TopKBase>(node)) {
+        axes = {static_cast<int64_t>(topK->get_axis())};
+    } else if (ov::is_type<ov::op::v0::CumSum>(node) && node->get_input_size() == 1) {
+        axes = {0};
+    } else if (ov::is_type<ov::op::v6::MVN>(node) || ov::is_type<ov::op::v0::NormalizeL2>(node) ||
+               ov::is_type<ov::op::v0::LRN>(node) || ov::is_type<ov::op::v0::CumSum>(node)) {
+        return getConstValues(node, 1, axes);
+    } else if (const auto reduce = ov::as_type_ptr<ov::op::util::ReductionBase>(node)) {
+        keepDims = reduce->get_keep_dims();
+        return getConstValues(node, 1, axes);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool propagateElementwise(const std::shared_ptr<ov::Node>& node, const std::vector<int64_t>& inAxes, int64_t& outAxis) {
+    if (ov::is_type<ov::op::v0::PRelu>(node) && inAxes[1] != noBatch)
+        return false;
+
+    const auto outRank = rankOf(node->get_output_partial_shape(0));
+    outAxis = noBatch;
+    for (size_t i = 0; i < inAxes.size(); i++) {
+        if (inAxes[i] == noBatch)
+            continue;
+        const auto axis = inAxes[i] + outRank - rankOf(node->get_input_partial_shape(i));
+        if (outAxis != noBatch && outAxis != axis)
+            return false;
+        outAxis = axis;
+    }
+    for (size_t i = 0; i < inAxes.size(); i++) {
+        if (inAxes[i] != noBatch)
+            continue;
+        const auto& shape = node->get_input_partial_shape(i);
+        const auto axis = outAxis - (outRank - rankOf(shape));
+        if (axis >= 0 && shape[axis] != 1)
+            return false;
+    }
+    return true;
+}
+
+bool propagateMatMul(const std::shared_ptr<ov::op::v0::MatMul>& matMul, const std::vector<int64_t>& inAxes, int64_t& outAxis) {
+    if (inAxes[0] == noBatch || inAxes[1] != noBatch)
+        return false;
+
+    const auto& shapeA = matMul->get_input_partial_shape(0);
+    const auto& shapeB = matMul->get_input_partial_shape(1);
+    const auto rankA = rankOf(shapeA);
+    const auto rankB = rankOf(shapeB);
+    const auto outRank = rankOf(matMul->get_output_partial_shape(0));
+    if (rankA < 2 || rankB < 2)
+        return false;
+
+    const auto axis = inAxes[0];
+    const auto rowsAxis = matMul->get_transpose_a() ? rankA - 1 : rankA - 2;
+    if (axis == rowsAxis) {
+        outAxis = outRank - 2;
+        return true;
+    }
+    // the batch mustn't be contracted
+    if (axis >= rankA - 2)
+        return false;
+
+    outAxis = axis + outRank - rankA;
+    const auto axisB = outAxis - (outRank - rankB);
+    return axisB < 0 || shapeB[axisB] == 1;
+}
+
+bool propagateBatchAxis(const std::shared_ptr<ov::Node>& node, const std::vector<int64_t>& inAxes, std::vector<int64_t>& outAxes) {
+    const auto axis = inAxes.empty() ? noBatch : inAxes[0];
+    const auto rank = inAxes.empty() ? 0 : rankOf(node->get_input_partial_shape(0));
+
+    if (ov::is_type<ov::op::v0::Result>(node)) {
+        // each row of the output belongs to one request
+        outAxes[0] = axis;
+        return axis == 0;
+    }
+
+    if (isElementwise(node))
+        return propagateElementwise(node, inAxes, outAxes[0]);
+
+    if (isPerBatchItem(node)) {
+        std::fill(outAxes.begin(), outAxes.end(), 0);
+        return axis == 0 && onlyDataIsBatched(inAxes);
+    }
+
+    if (const auto matMul = ov::as_type_ptr<ov::op::v0::MatMul>(node))
+        return propagateMatMul(matMul, inAxes, outAxes[0]);
+
+    if (!onlyDataIsBatched(inAxes)) {
+        // Concat is the only one of the remaining operations which merges the batched inputs
+        const auto concat = ov::as_type_ptr<ov::op::v0::Concat>(node);
+        if (!concat || std::any_of(inAxes.begin(), inAxes.end(), [&](int64_t item) { return item != axis; }))
+            return false;
+    }
+    std::fill(outAxes.begin(), outAxes.end(), axis);
+
+    std::vector<int64_t> axes;
+    bool keepDims = true;
+    if (getReducedAxes(node, axes, keepDims)) {
+        if (containsAxis(axes, axis, rank))
+            return false;
+        if (!keepDims) {
+            const auto removed = std::count_if(axes.begin(), axes.end(), [&](int64_t item) {
+                return (item < 0 ? item + rank : item) < axis;
+            });
+            std::fill(outAxes.begin(), outAxes.end(), axis - removed);
+        }
+        return true;
+    }
+
+    if (const auto concat = ov::as_type_ptr<ov::op::v0::Concat>(node))
+        return !containsAxis({concat->get_axis()}, axis, rank);
+
+    if (ov::is_type<ov::op::v1::Split>(node) || ov::is_type<ov::op::v1::VariadicSplit>(node))
+        return getConstValues(node, 1, axes) && !containsAxis(axes, axis, rank);
+
+    if (ov::is_type<ov::op::v1::Transpose>(node)) {
+        if (!getConstValues(node, 1, axes))
+            return false;
+        if (axes.empty()) {
+            std::fill(outAxes.begin(), outAxes.end(), rank - 1 - axis);
+            return true;
+        }
+        const auto position = std::find(axes.begin(), axes.end(), axis);
+        std::fill(outAxes.begin(), outAxes.end(), std::distance(axes.begin(), position));
+        return position != axes.end();
+    }
+
+    if (ov::is_type<ov::op::v1::Reshape>(node) || ov::is_type<ov::op::v0::Squeeze>(node) ||
+        ov::is_type<ov::op::v0::Unsqueeze>(node)) {
+        // the row-major reshape keeps the rows of the outermost dimension when the dimension itself is kept
+        return axis == 0 && node->get_output_partial_shape(0)[0] == checkedBatch;
+    }
+
+    if (const auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(node)) {
+        auto gatherAxis = gather->get_axis();
+        if (gatherAxis < 0)
+            gatherAxis += rank;
+        if (gather->get_batch_dims() != 0 || gatherAxis == axis)
+            return false;
+        if (gatherAxis < axis)
+            std::fill(outAxes.begin(), outAxes.end(), axis + rankOf(node->get_input_partial_shape(1)) - 1);
+        return true;
+    }
+
+    if (ov::is_type<ov::op::util::PadBase>(node)) {
+        std::vector<int64_t> padsEnd;
+        return getConstValues(node, 1, axes) && getConstValues(node, 2, padsEnd) &&
+               axes.at(axis) == 0 && padsEnd.at(axis) == 0;
+    }
+
+    if (ov::is_type<ov::op::v0::Tile>(node)) {
+        if (!getConstValues(node, 1, axes))
+            return false;
+        const auto outRank = rankOf(node->get_output_partial_shape(0));
+        outAxes[0] = axis + outRank - rank;
+        const auto repeatsAxis = outAxes[0] - (outRank - static_cast<int64_t>(axes.size()));
+        return repeatsAxis < 0 || axes[repeatsAxis] == 1;
+    }
+
+    // the operation unknown to the check (e.g. ShapeOf reading the batch) may mix the rows of the batch
+    return false;
+}
+
+bool isBatchIndependent(const std::shared_ptr<const ov::Model>& model) {
+    const auto batched = model->clone();
+    for (const auto& param : batched->get_parameters()) {
+        const auto& shape = param->get_output_partial_shape(0);
+        if (shape.is_dynamic() || shape.rank().get_length() == 0 || shape[0] != 1)
+            return false;
+        auto batchedShape = shape.to_shape();
+        batchedShape[0] = checkedBatch;
+        param->set_partial_shape(batchedShape);
+    }
+    try {
+        batched->validate_nodes_and_infer_types();
+    } catch (const ov::Exception&) {
+        return false;
+    }
+
+    std::map<ov::Output<ov::Node>, int64_t> batchAxes;
+    for (const auto& node : batched->get_ordered_ops()) {
+        std::vector<int64_t> inAxes;
+        bool isBatched = false;
+        for (const auto& input : node->input_values()) {
+            if (input.get_partial_shape().is_dynamic())
+                return false;
+            inAxes.push_back(batchAxes.at(input));
+            isBatched |= inAxes.back() != noBatch;
+        }
+
+        std::vector<int64_t> outAxes(node->get_output_size(), noBatch);
+        if (ov::is_type<ov::op::v0::Parameter>(node)) {
+            outAxes[0] = 0;
+        } else if (isBatched && !propagateBatchAxis(node, inAxes, outAxes)) {
+            return false;
+        }
+
+        for (size_t i = 0; i < outAxes.size(); i++) {
+            const auto& shape = node->get_output_partial_shape(i);
+            // the batch axis must stay the axis of the whole batch
+            if (outAxes[i] != noBatch &&
+                (shape.is_dynamic() || outAxes[i] >= rankOf(shape) || shape[outAxes[i]] != checkedBatch))
+                return false;
+            batchAxes[node->output(i)] = outAxes[i];
+        }
+    }
+    return true;
+}
+
+}   // namespace
+
+class RequestsCoalescer::CompletionExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    CompletionExecutor(std::shared_ptr<RequestsCoalescer> coalescer, InferRequestBase* request)
+        : _coalescer(std::move(coalescer)), _request(request) {}
+
+    void run(InferenceEngine::Task task) override {
+        _coalescer->RunWhenCompleted(_request, std::move(task));
+    }
+
+private:
+    const std::shared_ptr<RequestsCoalescer> _coalescer;
+    InferRequestBase* const _request;
+};
+
+RequestsCoalescer::RequestsCoalescer(size_t maxBatch, InferBatch inferBatch)
+    : _maxBatch(maxBatch), _inferBatch(std::move(inferBatch)) {}
+
+void RequestsCoalescer::Enqueue(InferRequestBase* request) {
+    auto key = request->GetCoalescingKey();
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.push_back({request, std::move(key)});
+}
+
+void RequestsCoalescer::Infer(InferRequestBase* request) {
+    std::vector<InferRequestBase*> batch;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto self = std::find_if(_pending.begin(), _pending.end(), [&](const PendingRequest& pending) {
+            return pending.request == request;
+        });
+        if (self == _pending.end()) {
+            // the request is inferred by the batch of another stream
+            if (_running.count(request) || _completed.count(request))
+                return;
+        } else {
+            const auto key = std::move(self->key);
+            _pending.erase(self);
+            batch.push_back(request);
+            // the cancelled request doesn't take the others, they are inferred by their own streams
+            if (!key.empty() && !request->IsCanceled()) {
+                for (auto it = _pending.begin(); it != _pending.end() && batch.size() < _maxBatch;) {
+                    if (it->key == key && !it->request->IsCanceled()) {
+                        batch.push_back(it->request);
+                        _running.emplace(it->request, nullptr);
+                        it = _pending.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+        }
+    }
+
+    // the request is inferred alone, also if it has been removed from the queue by the cancellation
+    if (batch.size() <= 1) {
+        request->InferImpl();
+        return;
+    }
+
+    std::exception_ptr exception;
+    try {
+        _inferBatch(batch);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    std::vector<InferenceEngine::Task> completions;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 1; i < batch.size(); i++) {
+            auto running = _running.find(batch[i]);
+            if (running->second)
+                completions.push_back(std::move(running->second));
+            _running.erase(running);
+            _completed[batch[i]] = exception;
+        }
+    }
+    // the completion stages whose requests have already reached them are run by the stream of the batch
+    for (auto& completion : completions)
+        completion();
+
+    if (exception)
+        std::rethrow_exception(exception);
+    request->ThrowIfCanceled();
+}
+
+InferenceEngine::ITaskExecutor::Ptr RequestsCoalescer::GetCompletionExecutor(InferRequestBase* request) {
+    return std::make_shared<CompletionExecutor>(shared_from_this(), request);
+}
+
+void RequestsCoalescer::RunWhenCompleted(InferRequestBase* request, InferenceEngine::Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto running = _running.find(request);
+        if (running != _running.end()) {
+            running->second = std::move(task);
+            return;
+        }
+    }
+    task();
+}
+
+void RequestsCoalescer::Complete(InferRequestBase* request) {
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto completed = _completed.find(request);
+        if (completed == _completed.end())
+            return;
+        exception = completed->second;
+        _completed.erase(completed);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+    request->ThrowIfCanceled();
+}
+
+void RequestsCoalescer::Remove(InferRequestBase* request) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.remove_if([&](const PendingRequest& pending) {
+        return pending.request == request;
+    });
+}
+
+void RequestsCoalescer::CheckBatchIndependence(const std::shared_ptr<ov::Model>& model) {
+    if (isBatchIndependent(model))
+        model->set_rt_info(true, batchIndependentKey);
+}
+
+bool RequestsCoalescer::IsBatchIndependent(const std::shared_ptr<const ov::Model>& model) {
+    return model->has_rt_info(batchIndependentKey);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
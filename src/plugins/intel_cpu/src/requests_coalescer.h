@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <threading/ie_itask_executor.hpp>
+#include <openvino/core/model.hpp>
+
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+class InferRequestBase;
+
+/**
+ * @brief Coalesces the asynchronous inference requests waiting in the streams executor queue into one batched inference.
+ * The request is enqueued when it is started and is inferred either by its own pipeline task or, together with the
+ * other compatible enqueued requests, by the task of the request which reached the stream first. The pipeline of the
+ * request taken into the batch of another stream doesn't occupy a stream while the batch is inferred: its completion
+ * stage is run by the stream of the batch when the batch is done.
+ */
+class RequestsCoalescer : public std::enable_shared_from_this<RequestsCoalescer> {
+public:
+    using InferBatch = std::function<void(const std::vector<InferRequestBase*>&)>;
+
+    RequestsCoalescer(size_t maxBatch, InferBatch inferBatch);
+
+    void Enqueue(InferRequestBase* request);
+
+    /**
+     * @brief Infers the request alone or together with the compatible enqueued requests. Returns at once if the request
+     * has been taken into the batch of another stream, the result is delivered by the completion stage.
+     */
+    void Infer(InferRequestBase* request);
+
+    /**
+     * @brief Returns the executor of the completion stage of the request pipeline, which runs the stage once the batch
+     * the request has been taken into is inferred
+     */
+    InferenceEngine::ITaskExecutor::Ptr GetCompletionExecutor(InferRequestBase* request);
+
+    /**
+     * @brief The completion stage of the request pipeline: rethrows the error of the batch the request was inferred by
+     */
+    void Complete(InferRequestBase* request);
+
+    /**
+     * @brief Forgets the request, so it's never taken into a batch (called on the request cancellation and destruction)
+     */
+    void Remove(InferRequestBase* request);
+
+    /**
+     * @brief Checks that each row of the outputs of the model depends only on the same row of the inputs, i.e. the
+     * requests inferred in one batch don't affect each other, and records the result in the runtime info of the model
+     * (so it's kept by the exported model). The model inputs and outputs must have the batch 1 in the outermost
+     * dimension. The check is conservative: the model with an operation unknown to it isn't batch independent.
+     */
+    static void CheckBatchIndependence(const std::shared_ptr<ov::Model>& model);
+
+    /**
+     * @brief Returns true if the model has been found batch independent by CheckBatchIndependence
+     */
+    static bool IsBatchIndependent(const std::shared_ptr<const ov::Model>& model);
+
+private:
+    class CompletionExecutor;
+
+    struct PendingRequest {
+        InferRequestBase* request;
+        std::string key;  // the requests with the same non-empty key may be inferred together
+    };
+
+    void RunWhenCompleted(InferRequestBase* request, InferenceEngine::Task task);
+
+    const size_t _maxBatch;
+    const InferBatch _inferBatch;
+
+    std::mutex _mutex;
+    std::list<PendingRequest> _pending;
+    // the requests taken into the batches being inferred by the other streams -> their deferred completion stages
+    std::unordered_map<InferRequestBase*, InferenceEngine::Task> _running;
+    std::unordered_map<InferRequestBase*, std::exception_ptr> _completed;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
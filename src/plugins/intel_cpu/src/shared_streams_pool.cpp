@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_streams_pool.h"
+#include "utils/debug_capabilities.h"
+
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+class SharedStreamsPool::ModelExecutor : public IStreamsExecutor {
+public:
+    ModelExecutor(SharedStreamsPool::Ptr pool, std::shared_ptr<ModelQueue> queue)
+        : _pool(std::move(pool)), _queue(std::move(queue)) {}
+
+    ~ModelExecutor() override {
+        _pool->Unregister(_queue);
+    }
+
+    void run(Task task) override {
+        _pool->Enqueue(_queue, std::move(task));
+    }
+
+    void Execute(Task task) override {
+        _pool->_executor->Execute(std::move(task));
+    }
+
+    int GetStreamId() override {
+        return _pool->_executor->GetStreamId();
+    }
+
+    int GetNumaNodeId() override {
+        return _pool->_executor->GetNumaNodeId();
+    }
+
+    int GetSocketId() override {
+        return _pool->_executor->GetSocketId();
+    }
+
+private:
+    const SharedStreamsPool::Ptr _pool;
+    const std::shared_ptr<ModelQueue> _queue;
+};
+
+SharedStreamsPool::SharedStreamsPool(const IStreamsExecutor::Config& config)
+    : _config(config) {
+    _executor = std::make_shared<CPUStreamsExecutor>(_config);
+}
+
+SharedStreamsPool::Ptr SharedStreamsPool::Get(const IStreamsExecutor::Config& config) {
+    static std::mutex mutex;
+    static std::weak_ptr<SharedStreamsPool> instance;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto pool = instance.lock();
+    if (!pool) {
+        auto poolConfig = config;
+        poolConfig._name = "CPUSharedStreamsExecutor";
+        instance = pool = std::make_shared<SharedStreamsPool>(poolConfig);
+    } else if (config._streams != pool->_config._streams || config._threadsPerStream != pool->_config._threadsPerStream) {
+        DEBUG_LOG("The streams config of the model (", config._streams, " streams, ", config._threadsPerStream,
+                  " threads per stream) is ignored, the model adopts the config of the shared streams pool (",
+                  pool->_config._streams, " streams, ", pool->_config._threadsPerStream, " threads per stream)");
+    }
+    return pool;
+}
+
+IStreamsExecutor::Ptr SharedStreamsPool::RegisterModel(ov::hint::Priority priority) {
+    auto queue = std::make_shared<ModelQueue>();
+    switch (priority) {
+    case ov::hint::Priority::LOW:
+        queue->weight = 1.0;
+        break;
+    case ov::hint::Priority::HIGH:
+        queue->weight = 4.0;
+        break;
+    default:
+        queue->weight = 2.0;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        queue->virtualTime = _virtualTime;
+        _queues.push_back(queue);
+    }
+    return std::make_shared<ModelExecutor>(shared_from_this(), queue);
+}
+
+void SharedStreamsPool::Enqueue(const std::shared_ptr<ModelQueue>& queue, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // the model that was idle doesn't get the credit for the time it didn't use the streams
+        if (queue->tasks.empty())
+            queue->virtualTime = std::max(queue->virtualTime, _virtualTime);
+        queue->tasks.push_back(std::move(task));
+    }
+    // every queued task is paired with one dispatch, which runs the task of the most underserved model instead
+    _executor->run([this] {
+        Dispatch();
+    });
+}
+
+void SharedStreamsPool::Unregister(const std::shared_ptr<ModelQueue>& queue) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    queue->registered = false;
+    if (queue->tasks.empty())
+        _queues.remove(queue);
+}
+
+void SharedStreamsPool::Dispatch() {
+    Task task;
+    std::shared_ptr<ModelQueue> queue;
+    double estimate = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto next = _queues.end();
+        for (auto it = _queues.begin(); it != _queues.end(); ++it) {
+            if (!(*it)->tasks.empty() && (next == _queues.end() || (*it)->virtualTime < (*next)->virtualTime))
+                next = it;
+        }
+        if (next == _queues.end())
+            return;
+
+        queue = *next;
+        task = std::move(queue->tasks.front());
+        queue->tasks.pop_front();
+        _virtualTime = queue->virtualTime;
+        // the task is charged by the average duration of the model tasks in advance, so the tasks dispatched to the
+        // other streams before it is completed see the model as served already
+        estimate = queue->averageDuration;
+        queue->virtualTime += estimate / queue->weight;
+        if (!queue->registered && queue->tasks.empty())
+            _queues.erase(next);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    // the model is charged by the core time its task has taken, whether the task succeeded or not
+    auto charge = [&] {
+        const auto duration = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        std::lock_guard<std::mutex> lock(_mutex);
+        queue->virtualTime += (duration - estimate) / queue->weight;
+        queue->averageDuration += (duration - queue->averageDuration) / 8.0;
+    };
+    try {
+        task();
+    } catch (...) {
+        charge();
+        throw;
+    }
+    charge();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
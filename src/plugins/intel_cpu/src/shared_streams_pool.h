@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <threading/ie_istreams_executor.hpp>
+#include <openvino/runtime/properties.hpp>
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief The process-wide streams executor shared by the compiled models (see ov::intel_cpu::shared_streams_pool).
+ * Instead of the own streams executor, which pins its threads to the same cores as the executors of the other models,
+ * the model gets a lightweight executor queueing the model tasks in the pool. The pool streams pick the queued tasks
+ * in the weighted fair order of the measured task durations, so under contention the models share the core time of the
+ * streams in proportion to the weights of their ov::hint::model_priority, while the idle models don't occupy any stream.
+ */
+class SharedStreamsPool : public std::enable_shared_from_this<SharedStreamsPool> {
+public:
+    using Ptr = std::shared_ptr<SharedStreamsPool>;
+
+    explicit SharedStreamsPool(const InferenceEngine::IStreamsExecutor::Config& config);
+
+    /**
+     * @brief Returns the pool of the process. The pool is created with the config if there is no alive one, so the
+     * config of the first model compiled with the shared pool defines the streams of the pool. The differing streams
+     * config of the later models is ignored and reported in the debug log.
+     */
+    static Ptr Get(const InferenceEngine::IStreamsExecutor::Config& config);
+
+    const InferenceEngine::IStreamsExecutor::Config& GetConfig() const {
+        return _config;
+    }
+
+    /**
+     * @brief Registers the model in the pool. The returned executor keeps the pool alive and unregisters the model
+     * when it is destroyed.
+     */
+    InferenceEngine::IStreamsExecutor::Ptr RegisterModel(ov::hint::Priority priority);
+
+private:
+    struct ModelQueue {
+        double weight;
+        double virtualTime = 0.0;      // the core time (us) the model tasks have taken, normalized by its weight
+        double averageDuration = 0.0;  // the moving average of the model task duration (us)
+        bool registered = true;
+        std::deque<InferenceEngine::Task> tasks;
+    };
+    class ModelExecutor;
+
+    void Enqueue(const std::shared_ptr<ModelQueue>& queue, InferenceEngine::Task task);
+    void Unregister(const std::shared_ptr<ModelQueue>& queue);
+    void Dispatch();
+
+    const InferenceEngine::IStreamsExecutor::Config _config;
+    std::mutex _mutex;
+    std::list<std::shared_ptr<ModelQueue>> _queues;
+    double _virtualTime = 0.0;
+    // declared last to finish the pending tasks before the queues are destroyed
+    InferenceEngine::IStreamsExecutor::Ptr _executor;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_prefetcher.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#    include <sched.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr size_t cacheLineSize = 64;
+// the newer request is checked once per page, so the check doesn't slow down the loading
+constexpr size_t pageSize = 4096;
+
+#if defined(__linux__)
+/* The helper thread keeps the affinity of the thread compiling the model, which isn't pinned to the cores of a stream,
+ * so it may run on any core of the process, but only when the core is idle, so it never preempts the compute threads.
+ */
+void runOnIdleCores() {
+    // the scheduling policy of Linux is set per thread
+    sched_param param{};
+    param.sched_priority = 0;
+    sched_setscheduler(0, SCHED_IDLE, &param);
+}
+#endif
+
+}   // namespace
+
+WeightsPrefetcher::WeightsPrefetcher(size_t budget) : _budget(budget), _thread(&WeightsPrefetcher::Run, this) {}
+
+WeightsPrefetcher::~WeightsPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+        _request++;
+    }
+    _requested.notify_one();
+    _thread.join();
+}
+
+void WeightsPrefetcher::Prefetch(MemoryCPtr weights) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _weights = std::move(weights);
+        _request++;
+    }
+    _requested.notify_one();
+}
+
+void WeightsPrefetcher::Run() {
+#if defined(__linux__)
+    runOnIdleCores();
+#endif
+    size_t served = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _requested.wait(lock, [&] {
+            return _request != served;
+        });
+        if (_stop)
+            return;
+        served = _request;
+        // the weights are kept alive until they are loaded even if the node has released them
+        const auto weights = _weights;
+        lock.unlock();
+
+        const auto data = static_cast<const volatile uint8_t*>(weights->getData());
+        const size_t size = std::min(weights->getSize(), _budget);
+        // one byte of each cache line is read, the demand load brings the line into the shared cache
+        for (size_t page = 0; page < size && _request.load(std::memory_order_relaxed) == served; page += pageSize) {
+            const size_t pageEnd = std::min(page + pageSize, size);
+            for (size_t offset = page; offset < pageEnd; offset += cacheLineSize)
+                static_cast<void>(data[offset]);
+        }
+
+        lock.lock();
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
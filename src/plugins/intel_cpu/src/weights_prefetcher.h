@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Loads the weights of the node into the last level cache by a helper thread while the previous nodes are
+ * executed, so the memory bound node doesn't wait for the beginning of its weights to be streamed from the memory.
+ * Only the first bytes of the weights up to the budget are loaded: the larger part would evict the data of the
+ * executed nodes and the beginning of the weights itself. On Linux the helper thread runs on the idle cores only,
+ * elsewhere it's scheduled as a regular thread. The helper thread inherits the affinity of the creating thread, so the
+ * prefetcher is created by the thread compiling the model rather than by the pinned stream threads. One prefetcher
+ * is shared by the graphs of all the streams of the compiled model, the request of one stream supersedes the
+ * unfinished request of another one.
+ */
+class WeightsPrefetcher {
+public:
+    using Ptr = std::shared_ptr<WeightsPrefetcher>;
+
+    explicit WeightsPrefetcher(size_t budget);
+    ~WeightsPrefetcher();
+
+    WeightsPrefetcher(const WeightsPrefetcher&) = delete;
+    WeightsPrefetcher& operator=(const WeightsPrefetcher&) = delete;
+
+    /**
+     * @brief Starts loading the weights, the loading of the previous ones is abandoned if it is not finished yet
+     */
+    void Prefetch(MemoryCPtr weights);
+
+private:
+    void Run();
+
+    const size_t _budget;
+
+    std::mutex _mutex;
+    std::condition_variable _requested;
+    MemoryCPtr _weights;
+    std::atomic<size_t> _request{0};  // incremented on each Prefetch, so the loading of the outdated weights stops
+    bool _stop = false;
+
+    std::thread _thread;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
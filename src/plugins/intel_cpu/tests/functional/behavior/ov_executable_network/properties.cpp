@@ -40,6 +40,15 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::shape_buckets.name()),
+        RO_property(ov::intel_cpu::max_coalesced_requests.name()),
+        RO_property(ov::intel_cpu::streams_auto_tuning.name()),
+        RO_property(ov::intel_cpu::shared_streams_pool.name()),
+        RO_property(ov::hint::model_priority.name()),
+        RO_property(ov::intel_cpu::dynamic_quantization.name()),
+        RO_property(ov::intel_cpu::weights_prefetch.name()),
+        RO_property(ov::intel_cpu::refine_memory_formats.name()),
+        RO_property(ov::intel_cpu::relax_static_inputs.name()),
     };
 
     ov::Core ie;
@@ -144,6 +153,32 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSharedStreamsPoolDefinesStreamsOfModels) {
+    ov::Core ie;
+    int32_t value = 0;
+
+    ov::AnyMap config;
+    config[ov::intel_cpu::shared_streams_pool.name()] = true;
+    config[ov::num_streams.name()] = 2;
+    ov::CompiledModel firstModel = ie.compile_model(model, deviceName, config);
+
+    // the pool is alive while the first model is, so its streams are used by the second model
+    config[ov::num_streams.name()] = 1;
+    config[ov::hint::model_priority.name()] = ov::hint::Priority::HIGH;
+    ov::CompiledModel secondModel = ie.compile_model(model, deviceName, config);
+
+    ASSERT_NO_THROW(value = secondModel.get_property(ov::num_streams));
+    ASSERT_EQ(2, value);
+    ASSERT_EQ(ov::hint::Priority::HIGH, secondModel.get_property(ov::hint::model_priority));
+
+    auto firstRequest = firstModel.create_infer_request();
+    auto secondRequest = secondModel.create_infer_request();
+    ASSERT_NO_THROW(firstRequest.start_async());
+    ASSERT_NO_THROW(secondRequest.start_async());
+    ASSERT_NO_THROW(firstRequest.wait());
+    ASSERT_NO_THROW(secondRequest.wait());
+}
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
@@ -47,6 +47,15 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RW_property(ov::intel_cpu::shape_buckets.name()),
+        RW_property(ov::intel_cpu::max_coalesced_requests.name()),
+        RW_property(ov::intel_cpu::streams_auto_tuning.name()),
+        RW_property(ov::intel_cpu::shared_streams_pool.name()),
+        RW_property(ov::hint::model_priority.name()),
+        RW_property(ov::intel_cpu::dynamic_quantization.name()),
+        RW_property(ov::intel_cpu::weights_prefetch.name()),
+        RW_property(ov::intel_cpu::refine_memory_formats.name()),
+        RW_property(ov::intel_cpu::relax_static_inputs.name()),
     };
 
     ov::Core ie;
@@ -187,7 +187,7 @@ protected:
         configuration.insert(additionalConfig.begin(), additionalConfig.end());
 
         cpuNodeType = "FullyConnected";
-        selectedType = makeSelectedTypeStr(selectedType, element::i8);
+        selectedType = makeSelectedTypeStr(selectedType, inType == ElementType::f32 ? element::f32 : element::i8);
 
         ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(inType, inShapeA)};
         auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<opset1::Parameter>(params));
@@ -333,6 +333,51 @@ const auto testParams3D_i8_sparse_smoke = ::testing::Combine(::testing::ValuesIn
 INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_I8_sparse, MatMulSparseCPUTest, testParams3D_i8_sparse_smoke,
     MatMulSparseCPUTest::getTestCaseName);
 
+// fp32 weights with enough zeros are compressed and multiplied by the sparse kernel on any ISA, when the sparse rate
+// threshold is set. The generated weights are well above the threshold, so the selection doesn't depend on the data.
+const std::map<std::string, std::string> NoBF16 = {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}};
+const std::map<std::string, std::string> NoBF16SparseRate80 = {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO},
+                                                               {CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "0.8"}};
+
+const auto testParams2D_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS2D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::Values(CPUSpecificParams{{}, {}, {"gemm_sparse"}, "gemm_sparse"}),
+                                                   ::testing::Values(NoBF16SparseRate80),
+                                                   ::testing::Values(0.9));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_FP32_sparse, MatMulSparseCPUTest, testParams2D_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
+const auto testParams3D_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS3D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::Values(CPUSpecificParams{{}, {}, {"gemm_sparse"}, "gemm_sparse"}),
+                                                   ::testing::Values(NoBF16SparseRate80),
+                                                   ::testing::Values(0.9));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_FP32_sparse, MatMulSparseCPUTest, testParams3D_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
+#ifdef OV_CPU_WITH_MLAS
+// the sparse kernel is switched off without the sparse rate threshold, whatever the sparsity of the weights
+const auto testParams2D_f32_no_sparse_rate_smoke = ::testing::Combine(::testing::ValuesIn(IS2D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::Values(CPUSpecificParams{{}, {}, {"gemm_mlas"}, "gemm_mlas"}),
+                                                   ::testing::Values(NoBF16),
+                                                   ::testing::Values(0.9));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_FP32_no_sparse_rate, MatMulSparseCPUTest, testParams2D_f32_no_sparse_rate_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+#endif
+
 } // namespace fullyConnected
 
 } // namespace
@@ -113,13 +113,17 @@ private:
 
 TEST_P(ReverseSequenceLayerCPUTest, CompareWithRefs) {
     run();
+    // the data is moved in its own precision, so no conversion is inserted around the node
+    CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Reorder"}, 0);
 }
 
 namespace {
 
 const std::vector<InferenceEngine::Precision> netPrecisions = {
         InferenceEngine::Precision::FP32,
-        InferenceEngine::Precision::I32
+        InferenceEngine::Precision::BF16,
+        InferenceEngine::Precision::I32,
+        InferenceEngine::Precision::I8
 };
 
 const int64_t batchAxisIndex = 0L;
@@ -93,6 +93,76 @@ TEST_P(TensorIteratorCPUTest, CompareWithRefs) {
     run();
 }
 
+/* The body ports are bound to the external memory instead of copying, when the chunk is a dense block of the external
+ * tensor. The sliced input is iterated in the reverse order, the invariant input is used by all the iterations and
+ * the concatenated output is written in the forward order. The batch of the dynamic shapes switches between 1 and 2,
+ * so the ports are bound, copied and bound again after the reshapes.
+
+       X [B, T, 8]    Y [B, 1, 8]
+             |            |
+     ------------TensorIterator------------
+     |  X_i [B, 1, 8]  Y [B, 1, 8]        |
+     |        \        /    |             |
+     |           Add        |             |
+     |             \        /             |
+     |              Multiply              |
+     --------------------------------------
+                     |
+                [B, T, 8]
+*/
+using TensorIteratorInPlaceParams = std::vector<InputShape>;
+
+class TensorIteratorInPlaceCPUTest : public testing::WithParamInterface<TensorIteratorInPlaceParams>,
+                                     virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TensorIteratorInPlaceParams> obj) {
+        const auto& shapes = obj.param;
+
+        std::ostringstream result;
+        for (size_t i = 0; i < shapes.size(); i++) {
+            result << "Input" << i << "_";
+            result << "IS=" << ov::test::utils::partialShape2str({shapes[i].first}) << "_";
+            result << "TS=";
+            for (const auto& item : shapes[i].second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes(GetParam());
+
+        const size_t sequence_axis = 1;
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ElementType::f32, shape));
+        }
+
+        ngraph::PartialShape slice_shape = inputDynamicShapes[0];
+        slice_shape[sequence_axis] = 1;
+        auto sliced = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, slice_shape);
+        auto invariant = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[1]);
+        auto add = std::make_shared<ov::op::v1::Add>(sliced, invariant);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(add, invariant);
+        auto body = std::make_shared<ov::Model>(ngraph::OutputVector{mul}, ov::ParameterVector{sliced, invariant}, "body");
+
+        auto tensor_iterator = std::make_shared<ov::op::v0::TensorIterator>();
+        tensor_iterator->set_function(body);
+        tensor_iterator->set_sliced_input(sliced, params[0], -1, -1, 1, 0, sequence_axis);
+        tensor_iterator->set_invariant_input(invariant, params[1]);
+        tensor_iterator->get_concatenated_slices(mul, 0, 1, 1, -1, sequence_axis);
+
+        function = std::make_shared<ov::Model>(ngraph::OutputVector{tensor_iterator->output(0)}, params, "TensorIteratorInPlace");
+    }
+};
+
+TEST_P(TensorIteratorInPlaceCPUTest, CompareWithRefs) {
+    run();
+}
+
 namespace {
 
 const std::vector<ElementType> inputPrecisions = {
@@ -154,5 +224,21 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple, TensorIteratorCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+const std::vector<std::vector<InputShape>> inPlaceInputs = {
+    // all the ports are bound
+    {{{}, {{1, 5, 8}}}, {{}, {{1, 1, 8}}}},
+    // the dimension before the axis isn't 1, only the invariant input is bound
+    {{{}, {{2, 5, 8}}}, {{}, {{2, 1, 8}}}},
+    // the inputs are bound, copied and bound again after the reshapes
+    {
+        {{-1, -1, 8}, {{1, 5, 8}, {2, 5, 8}, {1, 3, 8}, {1, 5, 8}, {2, 1, 8}}},
+        {{-1, 1, 8}, {{1, 1, 8}, {2, 1, 8}, {1, 1, 8}, {1, 1, 8}, {2, 1, 8}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorInPlace, TensorIteratorInPlaceCPUTest,
+                         ::testing::ValuesIn(inPlaceInputs),
+                         TensorIteratorInPlaceCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
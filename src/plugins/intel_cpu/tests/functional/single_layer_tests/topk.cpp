@@ -427,6 +427,45 @@ INSTANTIATE_TEST_CASE_P(smoke_Top1_dynamic, TopKLayerCPUTest,
         ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+std::vector<ov::test::InputShape> inputShapes_radix_select = {
+    {{}, {{1, 1, 1, 32000}}},
+    {{}, {{1, 2, 3, 8192}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_radix_select = {
+    {{1, 1, {1, 4}, -1}, {{1, 1, 1, 32000}, {1, 1, 4, 8192}, {1, 1, 2, 64}}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::Values(1, 50, 500),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::ValuesIn(additionalConfig)),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_dynamic, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::Values(1, 50),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapesDynamic_radix_select)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::ValuesIn(additionalConfig)),
+    TopKLayerCPUTest::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
@@ -6,6 +6,7 @@
 #include "ngraph_functions/builders.hpp"
 #include "test_utils/cpu_test_utils.hpp"
 #include <common_test_utils/ov_tensor_utils.hpp>
+#include "functional_test_utils/ov_plugin_cache.hpp"
 
 using namespace CPUTestUtils;
 using namespace ov::test;
@@ -138,6 +139,89 @@ TEST_P(UniqueLayerTestCPU, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Unique");
 }
 
+/*  The values are compared in the low precision the node is enforced to, when the node is followed by the MatMul
+ *  executed in that precision. The integer values are exact in both bf16 and f16, so the results match the f32
+ *  inference.
+
+        Param
+          |
+    Unique(axis 0)
+          |
+    MatMul(identity)
+          |
+        Result
+*/
+class UniqueLowPrecisionCPUTest : public ::testing::TestWithParam<ElementType> {
+protected:
+    void SetUp() override {
+        const auto precision = GetParam();
+        if (precision == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core())
+            GTEST_SKIP() << "The bf16 inference precision requires AVX512";
+        if (precision == ElementType::f16 && !InferenceEngine::with_cpu_x86_avx512_core_fp16())
+            GTEST_SKIP() << "The f16 inference precision requires AVX512 FP16";
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, ov::Shape{8, 4});
+        auto unique = std::make_shared<ov::op::v10::Unique>(param,
+                                                            ov::op::v0::Constant::create(ov::element::i64, ov::Shape({1}), {0}),
+                                                            true);
+        unique->set_friendly_name("unique");
+        std::vector<float> identity(16, 0.f);
+        for (size_t i = 0; i < 4; i++)
+            identity[i * 4 + i] = 1.f;
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(unique->output(0),
+                                                           ov::op::v0::Constant::create(ov::element::f32, {4, 4}, identity));
+        model = std::make_shared<ov::Model>(matMul, ov::ParameterVector{param}, "UniqueLowPrecision");
+    }
+
+    static ov::Tensor infer(ov::CompiledModel& compiledModel, const ov::Tensor& input) {
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        const auto& output = request.get_output_tensor();
+        ov::Tensor copy(output.get_element_type(), output.get_shape());
+        output.copy_to(copy);
+        return copy;
+    }
+
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_P(UniqueLowPrecisionCPUTest, CompareWithF32) {
+    const auto precision = GetParam();
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto lowPrecisionModel = core->compile_model(model, "CPU", ov::hint::inference_precision(precision));
+    auto f32Model = core->compile_model(model, "CPU", ov::hint::inference_precision(ElementType::f32));
+
+    bool checked = false;
+    for (const auto& node : lowPrecisionModel.get_runtime_model()->get_ops()) {
+        if (node->get_friendly_name() != "unique")
+            continue;
+        const auto runtimePrecision =
+            node->get_rt_info().at(ExecGraphInfoSerialization::RUNTIME_PRECISION).as<std::string>();
+        EXPECT_EQ(runtimePrecision, precision == ElementType::bf16 ? "BF16" : "FP16");
+        checked = true;
+    }
+    ASSERT_TRUE(checked) << "The runtime model doesn't contain the Unique node";
+
+    // the repeated rows, in the reversed order, so the sorting matters
+    ov::Tensor input(ElementType::f32, model->input().get_shape());
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        data[i] = static_cast<float>(static_cast<int>(7 - (i / 4) % 3) * ((i % 4) + 1) - 8);
+
+    const auto expected = infer(f32Model, input);
+    const auto actual = infer(lowPrecisionModel, input);
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    ASSERT_EQ(actual.get_shape(), (ov::Shape{3, 4}));
+    const auto expectedData = expected.data<const float>();
+    const auto actualData = actual.data<const float>();
+    for (size_t i = 0; i < expected.get_size(); i++)
+        ASSERT_EQ(expectedData[i], actualData[i]) << "element " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_UniqueLowPrecision, UniqueLowPrecisionCPUTest,
+                         ::testing::Values(ElementType::bf16, ElementType::f16));
+
 namespace {
 
 const std::vector<ElementType> dataPrecisionSmoke = {
@@ -0,0 +1,108 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+#include <cmath>
+
+namespace SubgraphTestsDefinitions {
+
+/*  The params of the dynamic nodes are prepared while the previous nodes are executed, when the stream has more than one
+ *  thread. The results must match the sequential preparation of the single threaded stream for any sequence of the
+ *  shapes, including the shapes growing the scratchpad of the executed nodes. The cancelled inference must not hang and
+ *  the request must be reusable after it.
+
+           Param
+             |
+        Convolution
+             |
+           Relu
+             |
+        Convolution
+             |
+      Softmax(axis 1)
+             |
+          Result
+*/
+class DynamicNodesPipeliningCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 8, -1, -1});
+        auto conv1 = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv1);
+        auto conv2 = ngraph::builder::makeConvolution(relu, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 8);
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(conv2, 1);
+        auto model = std::make_shared<ov::Model>(softmax, ov::ParameterVector{param}, "DynamicNodesPipelining");
+
+        auto core = ov::test::utils::PluginCache::get().core();
+        const auto precision = ov::hint::inference_precision(ov::element::f32);
+        pipelined = core->compile_model(model, "CPU", ov::num_streams(1), precision);
+        sequential = core->compile_model(model, "CPU", ov::num_streams(1), ov::inference_num_threads(1), precision);
+    }
+
+    static ov::Tensor makeInput(const ov::Shape& shape, size_t seed) {
+        ov::Tensor input(ov::element::f32, shape);
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = std::sin(0.01f * static_cast<float>(i) + static_cast<float>(seed));
+        return input;
+    }
+
+    void expectSequentialResult(ov::InferRequest& request, const ov::Tensor& input) {
+        auto reference = sequential.create_infer_request();
+        reference.set_input_tensor(input);
+        reference.infer();
+
+        const auto expected = reference.get_output_tensor();
+        const auto actual = request.get_output_tensor();
+        ASSERT_EQ(expected.get_shape(), actual.get_shape());
+        const auto expectedData = expected.data<const float>();
+        const auto actualData = actual.data<const float>();
+        for (size_t i = 0; i < expected.get_size(); i++)
+            ASSERT_NEAR(expectedData[i], actualData[i], 1e-5f) << "shape " << input.get_shape() << " element " << i;
+    }
+
+    // the shapes grow and shrink, so the params are both reused and recreated
+    const std::vector<ov::Shape> shapes = {{1, 8, 16, 16}, {2, 8, 32, 32}, {1, 8, 7, 9},  {1, 8, 64, 64},
+                                           {1, 8, 16, 16}, {4, 8, 33, 17}, {1, 8, 1, 1},  {2, 8, 64, 96}};
+    ov::CompiledModel pipelined;
+    ov::CompiledModel sequential;
+};
+
+TEST_F(DynamicNodesPipeliningCPUTest, smoke_MatchesSequentialPreparation) {
+    auto request = pipelined.create_infer_request();
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        for (size_t i = 0; i < shapes.size(); i++) {
+            const auto input = makeInput(shapes[i], i);
+            request.set_input_tensor(input);
+            request.infer();
+            expectSequentialResult(request, input);
+        }
+    }
+}
+
+TEST_F(DynamicNodesPipeliningCPUTest, smoke_CancelledInferenceDoesntHang) {
+    auto request = pipelined.create_infer_request();
+    for (size_t i = 0; i < shapes.size(); i++) {
+        request.set_input_tensor(makeInput(shapes[i], i));
+        request.start_async();
+        request.cancel();
+        try {
+            request.wait();
+        } catch (const ov::Cancelled&) {
+            // the inference may also be completed before the cancellation
+        }
+
+        // the request is reusable after the cancellation
+        const auto input = makeInput(shapes[(i + 1) % shapes.size()], i);
+        request.set_input_tensor(input);
+        request.infer();
+        expectSequentialResult(request, input);
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
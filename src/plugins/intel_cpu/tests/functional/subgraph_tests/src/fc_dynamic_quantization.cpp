@@ -0,0 +1,150 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "ie_system_conf.h"
+#include "exec_graph_info.hpp"
+
+#include <limits>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using FCDynamicQuantizationParams = std::tuple<InputShape,  // input shape
+                                               size_t,      // output channels
+                                               bool>;       // weights with a channel which can't be quantized
+
+/*  The fp32 MatMul with constant weights is converted to FullyConnected, which quantizes the weights to int8 at
+ *  compilation and the input at runtime when ov::intel_cpu::dynamic_quantization is set. The accuracy guard keeps the
+ *  layer in fp32 when a channel of its weights loses too much precision.
+
+        Input    Weights
+          \        /
+           MatMul
+             |
+           Result
+*/
+class FCDynamicQuantizationCPUTest : public testing::WithParamInterface<FCDynamicQuantizationParams>,
+                                     virtual public SubgraphBaseTest,
+                                     public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCDynamicQuantizationParams> obj) {
+        InputShape inputShape;
+        size_t outputChannels;
+        bool inaccurateWeights;
+        std::tie(inputShape, outputChannels, inaccurateWeights) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << ov::test::utils::vec2str(shape) << ")_";
+        }
+        result << "OC=" << outputChannels << "_";
+        result << "inaccurateWeights=" << inaccurateWeights;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t outputChannels;
+        bool inaccurateWeights;
+        std::tie(inputShape, outputChannels, inaccurateWeights) = this->GetParam();
+        init_input_shapes({inputShape});
+
+        const size_t K = inputDynamicShapes[0].rbegin()->get_length();
+        const size_t N = outputChannels;
+        std::vector<float> weights(K * N);
+        for (size_t k = 0; k < K; k++) {
+            for (size_t n = 0; n < N; n++) {
+                weights[k * N + n] = static_cast<float>(static_cast<int>((k * 7 + n * 3) % 17) - 8) / 8.f;
+            }
+        }
+        if (inaccurateWeights) {
+            // the values of the last channel fall in the middle between the int8 levels of its scale
+            for (size_t k = 0; k < K; k++) {
+                weights[k * N + N - 1] = k == 0 ? 127.f : 0.5f;
+            }
+        }
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0])};
+        auto weightsNode = ngraph::builder::makeConstant<float>(ElementType::f32, {K, N}, weights);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weightsNode);
+        function = std::make_shared<ov::Model>(matMul, params, "FCDynamicQuantization");
+
+        configuration.insert(ov::intel_cpu::dynamic_quantization(true));
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+        // the inputs and the weights are within [-1, 1], so both are quantized with the error up to 1/254 per value,
+        // the accumulated error of the output is much less than the bound below for K up to 256
+        abs_threshold = 0.25f;
+
+        const bool int8DotProduct = InferenceEngine::with_cpu_x86_avx512_core_vnni() ||
+                                    InferenceEngine::with_cpu_x86_avx2_vnni();
+        selectedType = int8DotProduct && !inaccurateWeights ? "gemm_dyn_quant_FP32" : "(?!gemm_dyn_quant).*";
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[0].get_element_type(), targetInputStaticShapes[0],
+                                                              2, -1, 256);
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), tensor});
+    }
+};
+
+TEST_P(FCDynamicQuantizationCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "FullyConnected");
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{4, 256}}},
+    {{-1, 256}, {{1, 256}, {7, 256}, {1, 256}}},
+    {{-1, -1, 128}, {{1, 5, 128}, {2, 3, 128}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCDynamicQuantization,
+                         FCDynamicQuantizationCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(64, 33),
+                                            ::testing::Values(false, true)),
+                         FCDynamicQuantizationCPUTest::getTestCaseName);
+
+}  // namespace
+
+// the NaN or infinite weights can't be quantized, they keep the layer in fp32 rather than turn into zeros
+TEST(FCDynamicQuantizationNonFiniteWeightsCPUTest, smoke_LayerStaysInFP32) {
+    const size_t K = 128, N = 16;
+    for (const float value : {std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity()}) {
+        std::vector<float> weights(K * N, 0.25f);
+        weights[K * N / 2] = value;
+        auto param = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, ov::Shape{4, K});
+        auto weightsNode = ngraph::builder::makeConstant<float>(ElementType::f32, {K, N}, weights);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weightsNode);
+        matMul->set_friendly_name("fc");
+        auto model = std::make_shared<ov::Model>(matMul, ov::ParameterVector{param}, "FCNonFiniteWeights");
+
+        ov::Core core;
+        auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, ov::intel_cpu::dynamic_quantization(true),
+                                                ov::hint::inference_precision(ov::element::f32));
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            if (node->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            const auto implType = node->get_rt_info().at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            EXPECT_EQ(implType.find("gemm_dyn_quant"), std::string::npos) << "weight " << value;
+        }
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,86 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*  The weights of the fully connected layers exceed the cache of the core, so with ov::intel_cpu::weights_prefetch
+ *  the weights of each next layer are loaded by the helper thread while the previous one is executed. The first layer
+ *  is the first executed node, so only the weights of the second and the third layers are prefetched.
+
+        Input
+          |
+        MatMul <- Weights0
+          |
+         Relu
+          |
+        MatMul <- Weights1
+          |
+         Relu
+          |
+        MatMul <- Weights2
+          |
+        Result
+*/
+class FCWeightsPrefetchCPUTest : public testing::WithParamInterface<size_t>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<size_t> obj) {
+        std::ostringstream result;
+        result << "M=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        const size_t M = this->GetParam();
+        const size_t K = 1024;
+        init_input_shapes({{{}, {{M, K}}}});
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0])};
+        std::shared_ptr<ov::Node> layer = params[0];
+        for (size_t i = 0; i < 3; i++) {
+            auto weights = ngraph::builder::makeConstant<float>(ElementType::f32, {K, K}, {}, true, 0.05f, -0.05f);
+            layer = std::make_shared<ov::op::v0::MatMul>(layer, weights);
+            if (i != 2)
+                layer = std::make_shared<ov::op::v0::Relu>(layer);
+        }
+        function = std::make_shared<ov::Model>(layer, params, "FCWeightsPrefetch");
+
+        configuration.insert(ov::intel_cpu::weights_prefetch(true));
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+    }
+};
+
+TEST_P(FCWeightsPrefetchCPUTest, CompareWithRefs) {
+    run();
+
+    size_t prefetched = 0;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        if (rtInfo.count("weightsPrefetchedDuring") == 0)
+            continue;
+        ASSERT_EQ(rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>(), "FullyConnected");
+        prefetched++;
+    }
+    ASSERT_EQ(prefetched, 2u);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsPrefetch,
+                         FCWeightsPrefetchCPUTest,
+                         ::testing::Values(1, 4),
+                         FCWeightsPrefetchCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,148 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*  The ports of the static If bodies refer to the external memory of the If node instead of copying, unless the body
+ *  may write to the external input or the body output memory is read by the other body nodes. The condition alternates
+ *  between the inferences, so the bodies bind the same external memory in turn. The inputs of the If node are also
+ *  the outputs of the model, so the body writing to the external input is caught by the comparison.
+
+       Cond   X   Y
+         \    |   |\
+          \   |   | \
+           \  |  /   \
+              If    Result(X), Result(Y)
+              |
+           Result(s)
+*/
+enum class IfBodies {
+    IN_PLACE_CONSUMER,      // the then body inputs and output go through the in-place Concat: the ports are copied
+    OUTPUT_WITH_CONSUMERS,  // the first body output is also read by the other body node: the output is copied
+    ALTERNATING_BRANCHES,   // all the ports of both bodies are bound
+};
+
+std::ostream& operator<<(std::ostream& os, IfBodies bodies) {
+    switch (bodies) {
+    case IfBodies::IN_PLACE_CONSUMER:
+        return os << "IN_PLACE_CONSUMER";
+    case IfBodies::OUTPUT_WITH_CONSUMERS:
+        return os << "OUTPUT_WITH_CONSUMERS";
+    default:
+        return os << "ALTERNATING_BRANCHES";
+    }
+}
+
+class IfPortBindingCPUTest : public testing::WithParamInterface<IfBodies>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<IfBodies>& obj) {
+        std::ostringstream result;
+        result << "Bodies=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto bodies = GetParam();
+
+        // the same static shapes are inferred once per condition value
+        const ov::Shape shape{2, 8, 4};
+        const std::vector<ov::Shape> inferences(conditions.size(), shape);
+        const std::vector<ov::Shape> condInferences(conditions.size(), ov::Shape{1});
+        init_input_shapes({{{}, condInferences}, {{}, inferences}, {{}, inferences}});
+
+        auto cond = std::make_shared<ov::op::v0::Parameter>(ov::element::boolean, ov::Shape{1});
+        auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto y = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+
+        auto px = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto py = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto qx = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto qy = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+
+        ov::ResultVector thenResults, elseResults;
+        switch (bodies) {
+        case IfBodies::IN_PLACE_CONSUMER: {
+            auto thenConcat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{px, py}, 0);
+            auto add = std::make_shared<ov::op::v1::Add>(qx, qy);
+            auto mul = std::make_shared<ov::op::v1::Multiply>(qx, qy);
+            auto elseConcat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{add, mul}, 0);
+            thenResults = {std::make_shared<ov::op::v0::Result>(thenConcat)};
+            elseResults = {std::make_shared<ov::op::v0::Result>(elseConcat)};
+            break;
+        }
+        case IfBodies::OUTPUT_WITH_CONSUMERS: {
+            auto add = std::make_shared<ov::op::v1::Add>(px, py);
+            auto thenMul = std::make_shared<ov::op::v1::Multiply>(add, py);
+            auto sub = std::make_shared<ov::op::v1::Subtract>(qx, qy);
+            auto elseMul = std::make_shared<ov::op::v1::Multiply>(sub, qx);
+            thenResults = {std::make_shared<ov::op::v0::Result>(add), std::make_shared<ov::op::v0::Result>(thenMul)};
+            elseResults = {std::make_shared<ov::op::v0::Result>(sub), std::make_shared<ov::op::v0::Result>(elseMul)};
+            break;
+        }
+        default: {
+            auto add = std::make_shared<ov::op::v1::Add>(px, py);
+            auto mul = std::make_shared<ov::op::v1::Multiply>(qx, qy);
+            thenResults = {std::make_shared<ov::op::v0::Result>(add)};
+            elseResults = {std::make_shared<ov::op::v0::Result>(mul)};
+        }
+        }
+
+        auto thenBody = std::make_shared<ov::Model>(thenResults, ov::ParameterVector{px, py});
+        auto elseBody = std::make_shared<ov::Model>(elseResults, ov::ParameterVector{qx, qy});
+        auto ifOp = std::make_shared<ov::op::v8::If>(cond);
+        ifOp->set_then_body(thenBody);
+        ifOp->set_else_body(elseBody);
+        ifOp->set_input(x, px, qx);
+        ifOp->set_input(y, py, qy);
+
+        ov::ResultVector results;
+        for (size_t i = 0; i < thenResults.size(); i++)
+            results.push_back(std::make_shared<ov::op::v0::Result>(ifOp->set_output(thenResults[i], elseResults[i])));
+        results.push_back(std::make_shared<ov::op::v0::Result>(x));
+        results.push_back(std::make_shared<ov::op::v0::Result>(y));
+
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{cond, x, y}, "IfPortBinding");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+
+        ov::Tensor condTensor(ov::element::boolean, targetInputStaticShapes[0]);
+        static_cast<char*>(condTensor.data())[0] = conditions[inferNum % conditions.size()];
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), condTensor});
+
+        for (size_t i = 1; i < funcInputs.size(); i++) {
+            const auto& funcInput = funcInputs[i];
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i],
+                                                                  10, -5, 1000, static_cast<int>(inferNum * 2 + i));
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+        inferNum++;
+    }
+
+    // each branch is executed more than once, and after the other one
+    const std::vector<bool> conditions = {true, false, false, true, true, false};
+    size_t inferNum = 0;
+};
+
+TEST_P(IfPortBindingCPUTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_IfPortBinding, IfPortBindingCPUTest,
+                         ::testing::Values(IfBodies::IN_PLACE_CONSUMER,
+                                           IfBodies::OUTPUT_WITH_CONSUMERS,
+                                           IfBodies::ALTERNATING_BRANCHES),
+                         IfPortBindingCPUTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
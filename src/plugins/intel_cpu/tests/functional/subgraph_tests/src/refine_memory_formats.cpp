@@ -0,0 +1,112 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+#include <numeric>
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*  The per channel scale follows the planar format of the input, so both of the convolutions consuming it in the blocked
+ *  format get a reorder. With ov::intel_cpu::refine_memory_formats the scale is switched to the blocked format: one
+ *  reorder of its input replaces the two reorders of its output. Without the property the formats are selected as
+ *  before.
+
+            Param
+              |
+        Multiply(scale)
+          /       \
+  Convolution   Convolution
+        |           |
+      Result      Result
+*/
+class RefineMemoryFormatsCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!InferenceEngine::with_cpu_x86_avx2())
+            GTEST_SKIP() << "The blocked formats of the convolution are tested on AVX2 and newer";
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16, 32, 32});
+        auto scaleValues = ngraph::builder::makeConstant<float>(ov::element::f32, {1, 16, 1, 1}, {}, true, 2.f, 0.5f);
+        auto scale = std::make_shared<ov::op::v1::Multiply>(param, scaleValues);
+        scale->set_friendly_name("scale");
+        ov::ResultVector results;
+        for (size_t i = 0; i < 2; i++) {
+            auto conv = ngraph::builder::makeConvolution(scale, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                         ov::op::PadType::EXPLICIT, 16);
+            results.push_back(std::make_shared<ov::op::v0::Result>(conv));
+        }
+        model = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "RefineMemoryFormats");
+    }
+
+    static size_t countReorders(const ov::CompiledModel& compiledModel) {
+        const auto ops = compiledModel.get_runtime_model()->get_ops();
+        return std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& node) {
+            return node->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == "Reorder";
+        });
+    }
+
+    static std::string scaleLayout(const ov::CompiledModel& compiledModel) {
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            if (node->get_friendly_name() == "scale")
+                return node->get_rt_info().at(ExecGraphInfoSerialization::OUTPUT_LAYOUTS).as<std::string>();
+        }
+        ADD_FAILURE() << "The runtime model doesn't contain the scale";
+        return {};
+    }
+
+    static ov::TensorVector infer(ov::CompiledModel& compiledModel, const ov::Tensor& input) {
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        ov::TensorVector outputs;
+        for (const auto& output : compiledModel.outputs()) {
+            const auto& tensor = request.get_tensor(output);
+            ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+            tensor.copy_to(copy);
+            outputs.push_back(copy);
+        }
+        return outputs;
+    }
+
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_F(RefineMemoryFormatsCPUTest, smoke_ScaleFollowsItsConsumers) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    const auto precision = ov::hint::inference_precision(ov::element::f32);
+    auto defaultModel = core->compile_model(model, "CPU", precision);
+    auto greedyModel = core->compile_model(model, "CPU", precision, ov::intel_cpu::refine_memory_formats(false));
+    auto refinedModel = core->compile_model(model, "CPU", precision, ov::intel_cpu::refine_memory_formats(true));
+
+    // the refinement is opt-in
+    const auto greedyReorders = countReorders(greedyModel);
+    EXPECT_EQ(countReorders(defaultModel), greedyReorders);
+    EXPECT_EQ(scaleLayout(defaultModel), scaleLayout(greedyModel));
+
+    EXPECT_EQ(scaleLayout(greedyModel), "abcd");
+    EXPECT_NE(scaleLayout(refinedModel), "abcd");
+    ASSERT_GT(greedyReorders, 0u);
+    CheckNumberOfNodesWithType(refinedModel, "Reorder", greedyReorders - 1);
+
+    ov::Tensor input(ov::element::f32, model->input().get_shape());
+    std::iota(input.data<float>(), input.data<float>() + input.get_size(), 0.f);
+    const auto expected = infer(greedyModel, input);
+    const auto actual = infer(refinedModel, input);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i].get_shape(), actual[i].get_shape());
+        const auto expectedData = expected[i].data<const float>();
+        const auto actualData = actual[i].data<const float>();
+        for (size_t j = 0; j < expected[i].get_size(); j++)
+            ASSERT_FLOAT_EQ(expectedData[j], actualData[j]) << "output " << i << " element " << j;
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,162 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+#include <cmath>
+
+namespace SubgraphTestsDefinitions {
+
+/*  The asynchronous requests started at once wait in the queue of the only stream and are coalesced into the batched
+ *  inferences. Each request must get the same results as the request inferred alone, also when the requests around it
+ *  are cancelled or destroyed. The model normalizing over the batch is never coalesced, otherwise the rows of the
+ *  requests would be normalized together.
+
+        Param                 Param
+          |                     |
+     Convolution          Softmax(axis 0)
+          |                     |
+        Relu                  Result
+          |
+        Result
+*/
+class RequestsCoalescingCPUTest : public ::testing::Test {
+protected:
+    static constexpr size_t requestsNum = 16;
+
+    static std::shared_ptr<ov::Model> makeConvModel() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 8, 16, 16});
+        auto conv = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        return std::make_shared<ov::Model>(relu, ov::ParameterVector{param}, "RequestsCoalescing");
+    }
+
+    static std::shared_ptr<ov::Model> makeSoftmaxModel() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 32});
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(param, 0);
+        return std::make_shared<ov::Model>(softmax, ov::ParameterVector{param}, "SoftmaxOverBatch");
+    }
+
+    static ov::Tensor makeInput(const ov::Shape& shape, size_t seed) {
+        ov::Tensor input(ov::element::f32, shape);
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = std::sin(0.1f * static_cast<float>(i) + static_cast<float>(seed));
+        return input;
+    }
+
+    void SetUp() override {
+        core = ov::test::utils::PluginCache::get().core();
+    }
+
+    void compile(const std::shared_ptr<ov::Model>& model) {
+        inputShape = model->input().get_shape();
+        reference = core->compile_model(model, "CPU", ov::num_streams(1), ov::hint::inference_precision(ov::element::f32));
+        coalescing = core->compile_model(model, "CPU", ov::num_streams(1), ov::hint::inference_precision(ov::element::f32),
+                                         ov::intel_cpu::max_coalesced_requests(4));
+    }
+
+    void expectReferenceResult(ov::InferRequest& request, size_t seed) {
+        auto referenceRequest = reference.create_infer_request();
+        referenceRequest.set_input_tensor(makeInput(inputShape, seed));
+        referenceRequest.infer();
+
+        const auto expected = referenceRequest.get_output_tensor();
+        const auto actual = request.get_output_tensor();
+        ASSERT_EQ(expected.get_shape(), actual.get_shape());
+        const auto expectedData = expected.data<const float>();
+        const auto actualData = actual.data<const float>();
+        for (size_t i = 0; i < expected.get_size(); i++) {
+            ASSERT_NEAR(expectedData[i], actualData[i], 1e-4f * std::max(1.f, std::abs(expectedData[i])))
+                << "request " << seed << " element " << i;
+        }
+    }
+
+    std::vector<ov::InferRequest> startRequests() {
+        std::vector<ov::InferRequest> requests;
+        for (size_t i = 0; i < requestsNum; i++) {
+            requests.push_back(coalescing.create_infer_request());
+            requests.back().set_input_tensor(makeInput(inputShape, i));
+        }
+        for (auto& request : requests)
+            request.start_async();
+        return requests;
+    }
+
+    std::shared_ptr<ov::Core> core;
+    ov::Shape inputShape;
+    ov::CompiledModel reference;
+    ov::CompiledModel coalescing;
+};
+
+TEST_F(RequestsCoalescingCPUTest, smoke_ConcurrentRequestsMatchSingleInference) {
+    compile(makeConvModel());
+    for (size_t iteration = 0; iteration < 4; iteration++) {
+        auto requests = startRequests();
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            expectReferenceResult(requests[i], i);
+        }
+    }
+}
+
+TEST_F(RequestsCoalescingCPUTest, smoke_CancelledRequestsDontAffectTheOthers) {
+    compile(makeConvModel());
+    auto requests = startRequests();
+    for (size_t i = 0; i < requests.size(); i += 2)
+        requests[i].cancel();
+
+    for (size_t i = 0; i < requests.size(); i++) {
+        try {
+            requests[i].wait();
+        } catch (const ov::Cancelled&) {
+            ASSERT_EQ(i % 2, 0) << "request " << i << " hasn't been cancelled";
+            continue;
+        }
+        // the cancelled request may have been inferred before the cancellation
+        expectReferenceResult(requests[i], i);
+    }
+
+    // the cancelled requests are reusable
+    for (size_t i = 0; i < requests.size(); i += 2)
+        requests[i].start_async();
+    for (size_t i = 0; i < requests.size(); i += 2) {
+        requests[i].wait();
+        expectReferenceResult(requests[i], i);
+    }
+}
+
+TEST_F(RequestsCoalescingCPUTest, smoke_DestroyedRequestsDontAffectTheOthers) {
+    compile(makeConvModel());
+    auto requests = startRequests();
+    // the destroyed request waits for its inference, the queue mustn't keep it
+    for (size_t i = 0; i < requests.size(); i += 2)
+        requests[i] = {};
+
+    for (size_t i = 1; i < requests.size(); i += 2) {
+        requests[i].wait();
+        expectReferenceResult(requests[i], i);
+    }
+
+    auto restarted = startRequests();
+    for (size_t i = 0; i < restarted.size(); i++) {
+        restarted[i].wait();
+        expectReferenceResult(restarted[i], i);
+    }
+}
+
+TEST_F(RequestsCoalescingCPUTest, smoke_BatchDependentModelIsNotCoalesced) {
+    compile(makeSoftmaxModel());
+    auto requests = startRequests();
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].wait();
+        // the softmax over the unit batch is 1, it would be less than 1 for the coalesced requests
+        expectReferenceResult(requests[i], i);
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,135 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+#include <cmath>
+
+namespace SubgraphTestsDefinitions {
+
+/*  The requests with the input shapes of a bucket are inferred by the static graph compiled for the bucket, the rest of
+ *  the requests by the dynamic graph. The graph the request was executed by is observed through the profiling info:
+ *  the counters of the graph that didn't execute the convolution report it as not run.
+
+        Param
+          |
+     Convolution
+          |
+        Result
+*/
+class ShapeBucketsCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32,
+                                                             ov::PartialShape{1, 16, ov::Dimension::dynamic(), ov::Dimension::dynamic()});
+        param->set_friendly_name("data");
+        auto conv = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 32);
+        conv->set_friendly_name("conv");
+        model = std::make_shared<ov::Model>(conv, ov::ParameterVector{param}, "ShapeBuckets");
+    }
+
+    static ov::ProfilingInfo::Status convStatus(ov::InferRequest& request) {
+        for (const auto& info : request.get_profiling_info()) {
+            if (info.node_name == "conv")
+                return info.status;
+        }
+        ADD_FAILURE() << "The profiling info doesn't contain the convolution";
+        return ov::ProfilingInfo::Status::NOT_RUN;
+    }
+
+    static void infer(ov::InferRequest& request, const ov::Shape& shape) {
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        request.set_input_tensor(input);
+        request.infer();
+    }
+
+    static ov::Tensor makeInput(const ov::Shape& shape, size_t seed) {
+        ov::Tensor input(ov::element::f32, shape);
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = std::sin(0.01f * static_cast<float>(i) + static_cast<float>(seed));
+        return input;
+    }
+
+    static void expectEqualOutputs(ov::InferRequest& expectedRequest, ov::InferRequest& actualRequest, const ov::Shape& shape) {
+        const auto expected = expectedRequest.get_output_tensor();
+        const auto actual = actualRequest.get_output_tensor();
+        ASSERT_EQ(expected.get_shape(), actual.get_shape()) << "input shape " << shape;
+        const auto expectedData = expected.data<const float>();
+        const auto actualData = actual.data<const float>();
+        for (size_t i = 0; i < expected.get_size(); i++)
+            ASSERT_NEAR(expectedData[i], actualData[i], 1e-4f) << "input shape " << shape << " element " << i;
+    }
+
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_F(ShapeBucketsCPUTest, smoke_RequestsAreRoutedByInputShape) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    // the requests share the only dynamic graph
+    auto compiledModel = core->compile_model(model, "CPU", ov::intel_cpu::shape_buckets("data[1,16,64,64]"),
+                                             ov::enable_profiling(true), ov::num_streams(1));
+
+    auto bucketRequest = compiledModel.create_infer_request();
+    auto dynamicRequest = compiledModel.create_infer_request();
+
+    infer(bucketRequest, {1, 16, 64, 64});
+    EXPECT_EQ(convStatus(bucketRequest), ov::ProfilingInfo::Status::EXECUTED);
+    // the dynamic graph hasn't executed anything yet
+    EXPECT_EQ(convStatus(dynamicRequest), ov::ProfilingInfo::Status::NOT_RUN);
+
+    infer(dynamicRequest, {1, 16, 48, 64});
+    EXPECT_EQ(convStatus(dynamicRequest), ov::ProfilingInfo::Status::EXECUTED);
+    EXPECT_EQ(dynamicRequest.get_output_tensor().get_shape(), (ov::Shape{1, 32, 48, 64}));
+
+    // the request keeps working with the dynamic graph after it has been executed by the bucket graph
+    infer(bucketRequest, {1, 16, 48, 64});
+    EXPECT_EQ(bucketRequest.get_output_tensor().get_shape(), (ov::Shape{1, 32, 48, 64}));
+}
+
+TEST_F(ShapeBucketsCPUTest, smoke_SwitchingGraphsMatchesDynamicCompilation) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    const auto precision = ov::hint::inference_precision(ov::element::f32);
+    auto compiledModel = core->compile_model(model, "CPU", ov::intel_cpu::shape_buckets("data[1,16,64,64];data[1,16,32,32]"),
+                                             precision, ov::num_streams(1));
+    auto dynamicModel = core->compile_model(model, "CPU", precision, ov::num_streams(1));
+
+    // the request switches between the graphs of the buckets and the dynamic graph back and forth
+    const std::vector<ov::Shape> shapes = {{1, 16, 64, 64}, {1, 16, 48, 64}, {1, 16, 64, 64}, {1, 16, 32, 32},
+                                           {1, 16, 7, 9},   {1, 16, 32, 32}, {1, 16, 64, 64}, {1, 16, 48, 64}};
+    auto request = compiledModel.create_infer_request();
+    auto reference = dynamicModel.create_infer_request();
+    for (size_t i = 0; i < shapes.size(); i++) {
+        const auto input = makeInput(shapes[i], i);
+        request.set_input_tensor(input);
+        request.infer();
+        reference.set_input_tensor(input);
+        reference.infer();
+        expectEqualOutputs(reference, request, shapes[i]);
+    }
+
+    // the output tensor set by the user is filled by both the bucket graph and the dynamic graph
+    for (const auto& shape : {ov::Shape{1, 16, 64, 64}, ov::Shape{1, 16, 48, 64}, ov::Shape{1, 16, 64, 64}}) {
+        const auto input = makeInput(shape, 0);
+        ov::Tensor output(ov::element::f32, {1, 32, shape[2], shape[3]});
+        request.set_input_tensor(input);
+        request.set_output_tensor(output);
+        request.infer();
+        reference.set_input_tensor(input);
+        reference.infer();
+        expectEqualOutputs(reference, request, shape);
+        EXPECT_EQ(request.get_output_tensor().data(), output.data());
+    }
+}
+
+TEST_F(ShapeBucketsCPUTest, smoke_UnknownInputIsRejected) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    EXPECT_THROW(core->compile_model(model, "CPU", ov::intel_cpu::shape_buckets("image[1,16,64,64]")), ov::Exception);
+}
+
+}  // namespace SubgraphTestsDefinitions
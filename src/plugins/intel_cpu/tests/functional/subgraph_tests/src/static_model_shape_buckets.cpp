@@ -0,0 +1,184 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+#include <algorithm>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using StaticModelShapeBucketsParams = std::tuple<InputShape,    // static model shape and the inferred shapes
+                                                 std::string>;  // shape buckets
+
+/*  The static model compiled with the shape buckets and ov::intel_cpu::relax_static_inputs accepts the inputs of the
+ *  bucket shapes without the recompilation: the spatial dimensions of the input become dynamic in the compiled model.
+ *  The shapes out of the buckets are executed by the dynamic graph.
+
+        Param
+          |
+     Convolution
+          |
+         Relu
+          |
+        Result
+*/
+class StaticModelShapeBucketsCPUTest : public testing::WithParamInterface<StaticModelShapeBucketsParams>,
+                                       virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<StaticModelShapeBucketsParams> obj) {
+        InputShape inputShape;
+        std::string buckets;
+        std::tie(inputShape, buckets) = obj.param;
+
+        std::ostringstream result;
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << ov::test::utils::vec2str(shape) << ")_";
+        }
+        result << "buckets=" << buckets;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        InputShape inputShape;
+        std::string buckets;
+        std::tie(inputShape, buckets) = this->GetParam();
+        init_input_shapes({inputShape});
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0])};
+        params[0]->set_friendly_name("data");
+        auto conv = ngraph::builder::makeConvolution(params[0], ElementType::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 8);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        function = std::make_shared<ov::Model>(relu, params, "StaticModelShapeBuckets");
+
+        configuration.insert(ov::intel_cpu::shape_buckets(buckets));
+        configuration.insert(ov::intel_cpu::relax_static_inputs(true));
+    }
+};
+
+TEST_P(StaticModelShapeBucketsCPUTest, CompareWithRefs) {
+    run();
+    ASSERT_TRUE(compiledModel.input().get_partial_shape().is_dynamic());
+}
+
+namespace {
+
+// the model is static: its shape is the first one
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 3, 16, 16}, {1, 3, 24, 24}, {1, 3, 16, 16}, {1, 3, 32, 20}, {1, 3, 24, 24}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_StaticModelShapeBuckets,
+                         StaticModelShapeBucketsCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values("data[1,3,24,24];data[1,3,32,20]",
+                                                              "data[1,3,24,24]")),
+                         StaticModelShapeBucketsCPUTest::getTestCaseName);
+
+}  // namespace
+
+/*  The original input shapes of the relaxed model are executed by the same graph as the static model compiled without
+ *  the relaxation: the elementwise tail is tokenized into the snippets and the shape computations of Reshape are
+ *  folded. Without ov::intel_cpu::relax_static_inputs the buckets don't change the static model.
+
+           Param
+             |
+        Convolution
+          |      \
+          |    ShapeOf
+          |       |
+          |  Gather(0, 1)
+          |       |
+          |  Concat(.., -1)
+           \     /
+           Reshape
+              |
+        Add(constant)
+              |
+           Sigmoid
+              |
+        Multiply(constant)
+              |
+           Result
+*/
+class RelaxedStaticModelCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+        param->set_friendly_name("data");
+        auto conv = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 8);
+        auto shapeOf = std::make_shared<ov::op::v3::ShapeOf>(conv, ov::element::i64);
+        auto batchAndChannels = std::make_shared<ov::op::v8::Gather>(
+            shapeOf,
+            ov::op::v0::Constant::create(ov::element::i64, {2}, {0, 1}),
+            ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+        auto targetShape = std::make_shared<ov::op::v0::Concat>(
+            ov::OutputVector{batchAndChannels, ov::op::v0::Constant::create(ov::element::i64, {1}, {-1})}, 0);
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(conv, targetShape, false);
+        auto add = std::make_shared<ov::op::v1::Add>(
+            reshape, ngraph::builder::makeConstant<float>(ov::element::f32, {1, 8, 1}, {}, true, 1.f, -1.f));
+        auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(add);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(
+            sigmoid, ngraph::builder::makeConstant<float>(ov::element::f32, {1, 8, 1}, {}, true, 2.f, 0.5f));
+        model = std::make_shared<ov::Model>(multiply, ov::ParameterVector{param}, "RelaxedStaticModel");
+        core = ov::test::utils::PluginCache::get().core();
+    }
+
+    // the types of the nodes executed by the last inference of the request
+    static std::vector<std::string> inferNodeTypes(ov::CompiledModel& compiledModel, const ov::Shape& shape) {
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(ov::Tensor(ov::element::f32, shape));
+        request.infer();
+        std::vector<std::string> types;
+        for (const auto& info : request.get_profiling_info())
+            types.push_back(info.node_type);
+        std::sort(types.begin(), types.end());
+        return types;
+    }
+
+    std::shared_ptr<ov::Model> model;
+    std::shared_ptr<ov::Core> core;
+    const std::string buckets = "data[1,3,24,24];data[1,3,32,20]";
+};
+
+TEST_F(RelaxedStaticModelCPUTest, smoke_OriginalShapesMatchStaticCompilation) {
+    const auto precision = ov::hint::inference_precision(ov::element::f32);
+    auto staticModel = core->compile_model(model, "CPU", precision, ov::enable_profiling(true));
+    auto relaxedModel = core->compile_model(model, "CPU", precision, ov::enable_profiling(true),
+                                            ov::intel_cpu::shape_buckets(buckets), ov::intel_cpu::relax_static_inputs(true));
+    ASSERT_TRUE(relaxedModel.input().get_partial_shape().is_dynamic());
+
+    const ov::Shape originalShape{1, 3, 16, 16};
+    const auto staticTypes = inferNodeTypes(staticModel, originalShape);
+    const auto relaxedTypes = inferNodeTypes(relaxedModel, originalShape);
+    EXPECT_EQ(relaxedTypes, staticTypes);
+    EXPECT_EQ(std::count(relaxedTypes.begin(), relaxedTypes.end(), "ShapeOf"), 0);
+    EXPECT_EQ(std::count(relaxedTypes.begin(), relaxedTypes.end(), "Subgraph"),
+              std::count(staticTypes.begin(), staticTypes.end(), "Subgraph"));
+
+    // the bucket shapes are accepted without the recompilation
+    auto request = relaxedModel.create_infer_request();
+    request.set_input_tensor(ov::Tensor(ov::element::f32, {1, 3, 32, 20}));
+    request.infer();
+    EXPECT_EQ(request.get_output_tensor().get_shape(), (ov::Shape{1, 8, 640}));
+}
+
+TEST_F(RelaxedStaticModelCPUTest, smoke_BucketsKeepStaticModelByDefault) {
+    auto compiledModel = core->compile_model(model, "CPU", ov::intel_cpu::shape_buckets(buckets));
+    EXPECT_FALSE(compiledModel.get_property(ov::intel_cpu::relax_static_inputs));
+    EXPECT_EQ(compiledModel.input().get_shape(), (ov::Shape{1, 3, 16, 16}));
+    EXPECT_EQ(compiledModel.output().get_shape(), (ov::Shape{1, 8, 256}));
+}
+
+}  // namespace SubgraphTestsDefinitions
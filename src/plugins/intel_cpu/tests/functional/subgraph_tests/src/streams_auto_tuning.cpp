@@ -0,0 +1,49 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+#include <sstream>
+
+namespace SubgraphTestsDefinitions {
+
+/*  The streams tuning selects the streams layout of the THROUGHPUT hint by the measured throughput and stores it in the
+ *  model, so the exported model is imported with the tuned layout without tuning again.
+
+        Param
+          |
+     Convolution
+          |
+        Result
+*/
+TEST(StreamsAutoTuningCPUTest, smoke_TunedStreamsAreApplied) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16, 32, 32});
+    auto conv = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ov::op::PadType::EXPLICIT, 16);
+    auto model = std::make_shared<ov::Model>(conv, ov::ParameterVector{param}, "StreamsAutoTuning");
+
+    auto core = ov::test::utils::PluginCache::get().core();
+    const auto hint = ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT);
+    auto tuned = core->compile_model(model, "CPU", hint, ov::intel_cpu::streams_auto_tuning(true));
+    EXPECT_TRUE(tuned.get_property(ov::intel_cpu::streams_auto_tuning));
+
+    const auto streams = tuned.get_property(ov::num_streams);
+    const auto threads = tuned.get_property(ov::inference_num_threads);
+    EXPECT_GT(streams.num, 0);
+
+    // the imported model gets the tuned layout, not the heuristic one
+    std::stringstream blob;
+    tuned.export_model(blob);
+    auto imported = core->import_model(blob, "CPU", {hint});
+    EXPECT_EQ(imported.get_property(ov::num_streams).num, streams.num);
+    EXPECT_EQ(imported.get_property(ov::inference_num_threads), threads);
+
+    auto request = tuned.create_infer_request();
+    request.infer();
+    EXPECT_EQ(request.get_output_tensor().get_shape(), (ov::Shape{1, 16, 32, 32}));
+}
+
+}  // namespace SubgraphTestsDefinitions
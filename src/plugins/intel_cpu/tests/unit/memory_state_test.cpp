@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu_memory.h>
+#include <memory_state.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+// three full blocks and a partial one
+constexpr size_t stateElements = 3 * StateBlockPool::blockSize / sizeof(float) + 100;
+constexpr size_t stateBlocks = 4;
+constexpr size_t elementsPerBlock = StateBlockPool::blockSize / sizeof(float);
+
+std::vector<float> makeValue(float start) {
+    std::vector<float> value(stateElements);
+    std::iota(value.begin(), value.end(), start);
+    return value;
+}
+
+std::vector<float> read(const PagedStateStorage& storage) {
+    std::vector<float> value(storage.size() / sizeof(float));
+    storage.Read(value.data());
+    return value;
+}
+
+MemoryPtr makeMemory(const std::vector<float>& value) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{value.size()});
+    auto memory = std::make_shared<Memory>(eng, desc);
+    std::copy(value.begin(), value.end(), static_cast<float*>(memory->getData()));
+    return memory;
+}
+
+std::vector<float> read(const Blob::CPtr& blob) {
+    auto data = blob->cbuffer().as<const float*>();
+    return std::vector<float>(data, data + blob->size());
+}
+
+}  // namespace
+
+TEST(PagedStateStorageTest, ZeroBlocksAreNotAllocated) {
+    auto pool = std::make_shared<StateBlockPool>();
+    PagedStateStorage storage(pool, stateElements * sizeof(float));
+    EXPECT_EQ(pool->GetUsedBlocks(), 0u);
+    EXPECT_EQ(read(storage), std::vector<float>(stateElements, 0.f));
+
+    storage.Write(std::vector<float>(stateElements, 0.f).data());
+    EXPECT_EQ(pool->GetUsedBlocks(), 0u);
+
+    storage.Write(makeValue(1.f).data());
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks);
+    EXPECT_EQ(read(storage), makeValue(1.f));
+}
+
+TEST(PagedStateStorageTest, SharedBlockIsCopiedOnWrite) {
+    auto pool = std::make_shared<StateBlockPool>();
+    PagedStateStorage original(pool, stateElements * sizeof(float));
+    original.Write(makeValue(1.f).data());
+
+    // the copy shares all the blocks
+    auto copy = original;
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks);
+
+    // only the modified block of the copy is allocated, the original keeps its value
+    auto modified = makeValue(1.f);
+    modified[2 * elementsPerBlock + 1] = -1.f;
+    copy.Write(modified.data());
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks + 1);
+    EXPECT_EQ(read(copy), modified);
+    EXPECT_EQ(read(original), makeValue(1.f));
+
+    // the unchanged shared blocks stay shared
+    original.Write(makeValue(1.f).data());
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks + 1);
+
+    // the block owned alone is overwritten in place
+    original.Write(modified.data());
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks + 1);
+    EXPECT_EQ(read(original), modified);
+}
+
+TEST(PagedStateStorageTest, ResetReleasesBlocksToPool) {
+    auto pool = std::make_shared<StateBlockPool>();
+    PagedStateStorage first(pool, stateElements * sizeof(float));
+    first.Write(makeValue(1.f).data());
+    auto second = first;
+    second.Write(makeValue(2.f).data());
+    EXPECT_EQ(pool->GetUsedBlocks(), 2 * stateBlocks);
+
+    first.Reset();
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks);
+    EXPECT_EQ(read(first), std::vector<float>(stateElements, 0.f));
+    EXPECT_EQ(read(second), makeValue(2.f));
+
+    second.Reset();
+    EXPECT_EQ(pool->GetUsedBlocks(), 0u);
+    EXPECT_EQ(pool->GetFreeBlocks(), 2 * stateBlocks);
+
+    // the released blocks are reused
+    first.Write(makeValue(3.f).data());
+    EXPECT_EQ(pool->GetFreeBlocks(), stateBlocks);
+    EXPECT_EQ(read(first), makeValue(3.f));
+}
+
+TEST(VariableStateTest, ResetStateHasNoBlocks) {
+    auto pool = std::make_shared<StateBlockPool>();
+    VariableState state("state", makeMemory(makeValue(1.f)), pool);
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks);
+
+    state.Reset();
+    EXPECT_EQ(pool->GetUsedBlocks(), 0u);
+    EXPECT_EQ(read(state.GetState()), std::vector<float>(stateElements, 0.f));
+
+    // the inference continues with the zero state
+    auto memory = makeMemory(makeValue(1.f));
+    state.CopyTo(memory);
+    auto data = static_cast<const float*>(memory->getData());
+    EXPECT_EQ(std::vector<float>(data, data + stateElements), std::vector<float>(stateElements, 0.f));
+}
+
+TEST(VariableStateTest, StateIsAdoptedAndReleasedAcrossRequests) {
+    auto pool = std::make_shared<StateBlockPool>();
+    // the states of the same variable in two requests
+    auto first = std::make_shared<VariableState>("state", makeMemory(makeValue(1.f)), pool);
+    auto second = std::make_shared<VariableState>("state", makeMemory(std::vector<float>(stateElements, 0.f)), pool);
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks);
+
+    // the value keeps the blocks it has been read from, the other request adopts them without copying
+    auto value = first->GetState();
+    second->SetState(std::const_pointer_cast<Blob>(value));
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks);
+    EXPECT_EQ(read(second->GetState()), makeValue(1.f));
+
+    // the block of the value modified after GetState is copied, the first request keeps its state
+    auto modified = makeValue(1.f);
+    modified[elementsPerBlock + 1] = -1.f;
+    std::const_pointer_cast<Blob>(value)->buffer().as<float*>()[elementsPerBlock + 1] = -1.f;
+    second->SetState(std::const_pointer_cast<Blob>(value));
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks + 1);
+    EXPECT_EQ(read(second->GetState()), modified);
+    EXPECT_EQ(read(first->GetState()), makeValue(1.f));
+
+    // the blocks stay with the second request when the first request and the value are released
+    value.reset();
+    first.reset();
+    EXPECT_EQ(pool->GetUsedBlocks(), stateBlocks);
+    EXPECT_EQ(pool->GetFreeBlocks(), 1u);
+    EXPECT_EQ(read(second->GetState()), modified);
+
+    second.reset();
+    EXPECT_EQ(pool->GetUsedBlocks(), 0u);
+    EXPECT_EQ(pool->GetFreeBlocks(), stateBlocks + 1);
+}
+
+TEST(VariableStateTest, SetStateOfWrongSizeThrows) {
+    auto pool = std::make_shared<StateBlockPool>();
+    VariableState state("state", makeMemory(makeValue(1.f)), pool);
+    auto value = make_shared_blob<float>(TensorDesc(Precision::FP32, {10}, Layout::C));
+    value->allocate();
+    EXPECT_THROW(state.SetState(value), InferenceEngine::Exception);
+}
@@ -379,3 +379,31 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SmokeSharedCacheConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+    constexpr size_t numThreads = 30;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        // the threads create and evict the same records of the cache, so the values must stay consistent
+        for (int n = 0; n < 100; ++n) {
+            for (int i = 0; i < 2 * capacity; ++i) {
+                auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(result.first, IntValueType());
+                ASSERT_EQ(*result.first, i);
+            }
+        }
+    };
+
+    std::vector<ScopedThread> vecThreads;
+    vecThreads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        vecThreads.emplace_back(std::thread(testRoutine));
+    }
+}
@@ -1217,6 +1217,26 @@ TEST_P(OVClassNetworkTestP, LoadNetworkActualNoThrow) {
     OV_ASSERT_NO_THROW(ie.compile_model(actualNetwork, target_device));
 }
 
+TEST_P(OVClassNetworkTestP, CompileModelAsyncNoThrow) {
+    ov::Core ie = createCoreWithTemplate();
+    auto future = ie.compile_model_async(actualNetwork, target_device);
+    ov::CompiledModel compiled_model;
+    OV_ASSERT_NO_THROW(compiled_model = future.get());
+    OV_ASSERT_NO_THROW(compiled_model.create_infer_request());
+}
+
+TEST_P(OVClassNetworkTestP, CompileModelAsyncDiscardedFutureNoThrow) {
+    ov::CompiledModel compiled_model;
+    {
+        ov::Core ie = createCoreWithTemplate();
+        // the discarded compilation continues in the background and doesn't block the next one
+        OV_ASSERT_NO_THROW(ie.compile_model_async(actualNetwork, target_device));
+        auto future = ie.compile_model_async(actualNetwork, target_device);
+        OV_ASSERT_NO_THROW(compiled_model = future.get());
+    }
+    OV_ASSERT_NO_THROW(compiled_model.create_infer_request());
+}
+
 TEST_P(OVClassNetworkTestP, LoadNetworkMultiWithoutSettingDevicePrioritiesThrows) {
     ov::Core ie = createCoreWithTemplate();
     try {